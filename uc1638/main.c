@@ -4,6 +4,7 @@
 #include "gpio.h"
 // 引入 LCD 驱动
 #include "uc1638.h"
+#include "uc1638_label.h"
 
 int main(void)
 {
@@ -34,9 +35,9 @@ int main(void)
               UC1638_DrawCircle(80, 40, 20, COLOR_BLACK);
               // 对角线
               UC1638_DrawLine(0, 0, 127, 127, COLOR_BLACK);
-              // 文字
-              UC1638_ShowString(10, 60, "Hello", COLOR_BLACK);
-              UC1638_ShowString(10, 80, "P3PLUS LCD", COLOR_BLACK);
+              // 文字 (固定标题走缓存，第二轮起直接拷贝位图)
+              UC1638_Label_Draw(10, 60, "Hello", COLOR_BLACK);
+              UC1638_Label_Draw(10, 80, "P3PLUS LCD", COLOR_BLACK);
               // 数字
               UC1638_ShowInt(10, 100, 12345, 5, COLOR_BLACK);
               break;
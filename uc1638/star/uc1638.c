@@ -9,9 +9,12 @@ P3PLUS LCD (UC1638) ESP-IDF 驱动 - MOSI=36 适配版
 #include "sdkconfig.h"
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
+#include "freertos/timers.h"
 #include "driver/gpio.h"
 #include "driver/spi_master.h"
 #include "esp_log.h"
+#include "esp_timer.h"
+#include "../uc1638_seq.h"          // 与 STM32 驱动共用的初始化序列
 
 // ====================== 1. 硬件引脚配置（核心修改：MOSI=36） ======================
 #define LCD_SCLK_PIN    18           // SPI2_SCLK（时钟，固定）
@@ -29,6 +32,9 @@ P3PLUS LCD (UC1638) ESP-IDF 驱动 - MOSI=36 适配版
 #define LCD_ROWS        128           // 行数
 #define LCD_PAGES       16            // 页数（128行/8位=16页）
 #define LCD_BUF_SIZE    (LCD_PAGES * LCD_COLS)
+#define LCD_COL_OFFSET  55            // 物理列偏移
+#define LCD_CONTRAST    170           // Vbias 对比度
+#define LCD_BIAS        2             // 偏压比 (0xE8 | 2)
 
 // ====================== 3. 全局变量 ======================
 spi_device_handle_t spi_handle;       // SPI 设备句柄
@@ -97,10 +103,10 @@ void lcd_spi_send(uint8_t data, bool is_cmd) {
     }
 }
 
-void lcd_spi_send_bulk(uint8_t* data, uint16_t len) {
+void lcd_spi_send_buf(const uint8_t* data, uint16_t len, bool is_cmd) {
     esp_err_t ret;
     spi_transaction_t t = {0};
-    gpio_set_level(LCD_DC_PIN, 1);
+    gpio_set_level(LCD_DC_PIN, is_cmd ? 0 : 1);
     t.length = len * 8;
     t.tx_buffer = data;
     ret = spi_device_transmit(spi_handle, &t);
@@ -109,6 +115,10 @@ void lcd_spi_send_bulk(uint8_t* data, uint16_t len) {
     }
 }
 
+void lcd_spi_send_bulk(uint8_t* data, uint16_t len) {
+    lcd_spi_send_buf(data, len, false);
+}
+
 void lcd_hw_reset(void) {
     gpio_set_level(LCD_RST_PIN, 0);
     vTaskDelay(pdMS_TO_TICKS(20));
@@ -116,50 +126,35 @@ void lcd_hw_reset(void) {
     vTaskDelay(pdMS_TO_TICKS(20));
 }
 
+// 展开并发送命令序列，同电平的连续字节合并为一次 SPI 事务
+void lcd_send_seq(const uint8_t* seq) {
+    const UC1638_Panel_t panel = {
+        .contrast = LCD_CONTRAST,
+        .bias = LCD_BIAS,
+        .map = 0x04,                 // LCD Map Control (0xC4)
+        .col_offset = LCD_COL_OFFSET,
+        .width = LCD_COLS,
+    };
+    uint8_t batch[32];
+    uint8_t is_cmd = 1;
+    uint8_t delay_ms;
+
+    while (1) {
+        uint16_t n = UC1638_Seq_Next(&seq, &panel, batch, sizeof(batch), &is_cmd, &delay_ms);
+        if (n > 0) {
+            lcd_spi_send_buf(batch, n, is_cmd);
+        } else if (delay_ms > 0) {
+            vTaskDelay(pdMS_TO_TICKS(delay_ms));
+        } else {
+            break;
+        }
+    }
+}
+
 void lcd_init(void) {
     lcd_hw_reset();
-
-    // 软复位
-    lcd_spi_send(0xE1, true);
-    lcd_spi_send(0xE2, true);
-    vTaskDelay(pdMS_TO_TICKS(2));
-
-    // 显示控制
-    lcd_spi_send(0xA4, true);
-    lcd_spi_send(0xA6, true);
-
-    // 电源管理
-    lcd_spi_send(0xB8, true); lcd_spi_send(0x00, false);
-    lcd_spi_send(0x2D, true);
-    lcd_spi_send(0x20, true);
-    lcd_spi_send(0xEA, true);
-
-    // 对比度
-    lcd_spi_send(0x81, true); lcd_spi_send(170, false);
-
-    // 扫描控制
-    lcd_spi_send(0xA3, true);
-    lcd_spi_send(0xC8, true); lcd_spi_send(0x2F, false);
-
-    // 地址映射
-    lcd_spi_send(0x89, true); lcd_spi_send(0x95, true);
-    lcd_spi_send(0x84, true);
-    lcd_spi_send(0xF1, true); lcd_spi_send(127, false);
-    lcd_spi_send(0xC4, true);
-    lcd_spi_send(0x86, true);
-
-    // 滚动与窗口
-    lcd_spi_send(0x40, true); lcd_spi_send(0x50, true);
-    lcd_spi_send(0x04, true); lcd_spi_send(55, false);
-
-    // 窗口范围
-    lcd_spi_send(0xF4, true); lcd_spi_send(55, false);
-    lcd_spi_send(0xF6, true); lcd_spi_send(182, false);
-    lcd_spi_send(0xF5, true); lcd_spi_send(0, false);
-    lcd_spi_send(0xF7, true); lcd_spi_send(15, false);
-    lcd_spi_send(0xF9, true);
-
-    lcd_spi_send(0xC9, true); lcd_spi_send(0xAD, false);
+    lcd_spi_send(0xE1, true);        // 本移植原有的初始化在 System Reset 前多发 0xE1，只在 ESP32 上保留
+    lcd_send_seq(UC1638_SEQ_INIT);
     ESP_LOGI(TAG, "LCD初始化完成");
 }
 
@@ -199,13 +194,13 @@ void spi_bus_init(void) {
     };
     gpio_config(&io_conf);
 
-    // 初始化退出按键
+    // 初始化退出按键（按下为低电平，下降沿触发中断）
     gpio_config_t key_conf = {
         .pin_bit_mask = (1ULL << EXIT_KEY_PIN),
         .mode = GPIO_MODE_INPUT,
         .pull_up_en = GPIO_PULLUP_ENABLE,
         .pull_down_en = GPIO_PULLDOWN_DISABLE,
-        .intr_type = GPIO_INTR_DISABLE,
+        .intr_type = GPIO_INTR_NEGEDGE,
     };
     gpio_config(&key_conf);
 
@@ -375,7 +370,7 @@ void lcd_flush(void) {
         lcd_spi_send(0x70 | (page >> 4), true);
 
         lcd_spi_send(0x04, true);
-        lcd_spi_send(55, false);
+        lcd_spi_send(LCD_COL_OFFSET, false);
 
         lcd_spi_send(0x01, true);
 
@@ -384,69 +379,183 @@ void lcd_flush(void) {
     }
 }
 
-// ====================== 8. 演示任务 ======================
-void lcd_demo_task(void* arg) {
-    typedef enum {
-        STATE_DEMO = 0,
-        STATE_CHECKERBOARD,
-        STATE_SPLIT,
-        STATE_MAX
-    } lcd_state_t;
+// 进入省电：控制器保留显存，唤醒时无需复位与重新初始化
+void lcd_sleep(void) {
+    lcd_send_seq(UC1638_SEQ_SLEEP);
+}
+
+// 退出省电并刷新显存
+// 控制器 RAM 在省电期间保持，但本移植不记录脏区 (STM32 驱动按脏区补发)，
+// 无法知道休眠期间画过哪些页，只能整屏重发
+void lcd_resume(void) {
+    lcd_send_seq(UC1638_SEQ_WAKE);
+    lcd_flush();
+}
+
+// ====================== 8. 显示服务（事件驱动） ======================
+// 任务平时无限期阻塞在任务通知上，只有以下事件会唤醒：
+//   按键中断 / 状态切换定时器 / 其他任务调用 lcd_request_redraw()
+// 事件以通知位的形式合并，同一事件在处理前多次到达只处理一次
+#define LCD_EVT_REDRAW      (1UL << 0)   // 重绘当前画面
+#define LCD_EVT_KEY         (1UL << 1)   // 退出按键按下
+#define LCD_EVT_SWITCH      (1UL << 2)   // 切换到下一画面
+
+typedef enum {
+    STATE_DEMO = 0,
+    STATE_CHECKERBOARD,
+    STATE_SPLIT,
+    STATE_MAX
+} lcd_state_t;
+
+// 按键到像素的延迟统计（微秒，从中断入口到刷新完成）
+typedef struct {
+    int64_t last_us;
+    int64_t min_us;
+    int64_t max_us;
+    uint32_t count;
+} lcd_latency_t;
+
+// 任务创建后句柄不再改变：退出时任务挂起而不删除，迟到的通知只置位，不会发往已删除的任务
+static TaskHandle_t lcd_task_handle = NULL;
+static TimerHandle_t lcd_switch_timer = NULL;
+// 64 位时间戳在 32 位核上分两次读写，中断与任务之间的访问都放在临界区内
+static portMUX_TYPE lcd_key_mux = portMUX_INITIALIZER_UNLOCKED;
+static int64_t lcd_key_time_us = 0;
+static lcd_latency_t lcd_key_latency = { 0, INT64_MAX, 0, 0 };
+static uint32_t lcd_redraw_requests = 0;          // 累计请求数 (多个任务递增，在 lcd_key_mux 内读写)
+static uint32_t lcd_redraw_done = 0;              // 实际重绘次数（合并后）
+
+static void IRAM_ATTR lcd_key_isr(void* arg) {
+    BaseType_t woken = pdFALSE;
+    int64_t now = esp_timer_get_time();
+
+    if (lcd_task_handle == NULL) return;
+    portENTER_CRITICAL_ISR(&lcd_key_mux);
+    if (lcd_key_time_us == 0) lcd_key_time_us = now; // 按键抖动时只记第一个沿
+    portEXIT_CRITICAL_ISR(&lcd_key_mux);
+    xTaskNotifyFromISR(lcd_task_handle, LCD_EVT_KEY, eSetBits, &woken);
+    portYIELD_FROM_ISR(woken);
+}
+
+static void lcd_switch_timer_cb(TimerHandle_t timer) {
+    if (lcd_task_handle != NULL) {
+        xTaskNotify(lcd_task_handle, LCD_EVT_SWITCH, eSetBits);
+    }
+}
+
+// 供其他任务调用：请求重绘当前画面，处理前的重复请求自动合并
+void lcd_request_redraw(void) {
+    portENTER_CRITICAL(&lcd_key_mux);
+    lcd_redraw_requests++;
+    portEXIT_CRITICAL(&lcd_key_mux);
+    if (lcd_task_handle != NULL) {
+        xTaskNotify(lcd_task_handle, LCD_EVT_REDRAW, eSetBits);
+    }
+}
+
+// 在同一临界区内读取延迟统计与重绘请求数
+static void lcd_get_key_latency(lcd_latency_t* out, uint32_t* requests) {
+    portENTER_CRITICAL(&lcd_key_mux);
+    *out = lcd_key_latency;
+    *requests = lcd_redraw_requests;
+    portEXIT_CRITICAL(&lcd_key_mux);
+}
+
+static void lcd_draw_state(lcd_state_t state) {
+    switch (state) {
+        case STATE_DEMO:
+            lcd_clear_screen(0);
+            lcd_draw_rectangle(0, 0, 127, 127, 1);
+            lcd_draw_circle(80, 40, 20, 1);
+            lcd_draw_line(0, 0, 127, 127, 1);
+            lcd_show_string(10, 60, "Hello", 1, 0, 12);
+            lcd_show_string(10, 80, "P3PLUS LCD", 1, 0, 12);
+            lcd_show_int_num(10, 100, 12345, 5, 1, 0, 12);
+            break;
+
+        case STATE_CHECKERBOARD:
+            lcd_draw_checkerboard();
+            break;
+
+        case STATE_SPLIT:
+            lcd_draw_split_screen();
+            break;
+
+        default:
+            break;
+    }
+    lcd_flush();
+}
+
+static void lcd_record_key_latency(void) {
+    int64_t now = esp_timer_get_time();
+    int64_t us;
+
+    portENTER_CRITICAL(&lcd_key_mux);
+    us = now - lcd_key_time_us;
+    lcd_key_time_us = 0;
+    lcd_key_latency.last_us = us;
+    if (us < lcd_key_latency.min_us) lcd_key_latency.min_us = us;
+    if (us > lcd_key_latency.max_us) lcd_key_latency.max_us = us;
+    lcd_key_latency.count++;
+    portEXIT_CRITICAL(&lcd_key_mux);
+}
 
+void lcd_demo_task(void* arg) {
+    static const char* const state_names[STATE_MAX] = {
+        "几何图形与文字演示", "3x3棋盘格", "上下分屏"
+    };
     lcd_state_t current_state = STATE_DEMO;
-    TickType_t last_switch_time = xTaskGetTickCount();
-    const TickType_t switch_interval = pdMS_TO_TICKS(5000);
+    lcd_latency_t latency;
+    uint32_t requests;
+    uint32_t events;
 
     while (1) {
-        if (gpio_get_level(EXIT_KEY_PIN) == 0) {
-            ESP_LOGI(TAG, "检测到退出按键，清空屏幕并停止任务");
+        xTaskNotifyWait(0, UINT32_MAX, &events, portMAX_DELAY);
+
+        if (events & LCD_EVT_KEY) {
+            // 停止事件源；其他任务或另一核上的中断仍可能持有句柄正在通知，
+            // 因此任务只挂起不删除，句柄始终有效
+            xTimerStop(lcd_switch_timer, 0);
+            gpio_intr_disable(EXIT_KEY_PIN);
+
             lcd_clear_screen(0);
             lcd_flush();
-            vTaskDelete(NULL);
+            lcd_record_key_latency();
+            lcd_get_key_latency(&latency, &requests);
+            ESP_LOGI(TAG, "检测到退出按键，清空屏幕并停止任务 (按键到像素 %lld us，重绘请求 %lu 次，实际重绘 %lu 次)",
+                     (long long)latency.last_us,
+                     (unsigned long)requests, (unsigned long)lcd_redraw_done);
+            vTaskSuspend(NULL);
         }
 
-        if (xTaskGetTickCount() - last_switch_time >= switch_interval) {
-            last_switch_time = xTaskGetTickCount();
+        if (events & LCD_EVT_SWITCH) {
             current_state = (lcd_state_t)((current_state + 1) % STATE_MAX);
-
-            switch (current_state) {
-                case STATE_DEMO:
-                    ESP_LOGI(TAG, "切换至：几何图形与文字演示");
-                    lcd_clear_screen(0);
-                    lcd_draw_rectangle(0, 0, 127, 127, 1);
-                    lcd_draw_circle(80, 40, 20, 1);
-                    lcd_draw_line(0, 0, 127, 127, 1);
-                    lcd_show_string(10, 60, "Hello", 1, 0, 12);
-                    lcd_show_string(10, 80, "P3PLUS LCD", 1, 0, 12);
-                    lcd_show_int_num(10, 100, 12345, 5, 1, 0, 12);
-                    lcd_flush();
-                    break;
-
-                case STATE_CHECKERBOARD:
-                    ESP_LOGI(TAG, "切换至：3x3棋盘格");
-                    lcd_draw_checkerboard();
-                    lcd_flush();
-                    break;
-
-                case STATE_SPLIT:
-                    ESP_LOGI(TAG, "切换至：上下分屏");
-                    lcd_draw_split_screen();
-                    lcd_flush();
-                    break;
-
-                default:
-                    break;
-            }
+            ESP_LOGI(TAG, "切换至：%s", state_names[current_state]);
+            events |= LCD_EVT_REDRAW;
         }
 
-        vTaskDelay(pdMS_TO_TICKS(100));
+        if (events & LCD_EVT_REDRAW) {
+            lcd_draw_state(current_state);
+            lcd_redraw_done++;
+        }
     }
 }
 
+// 按键下降沿中断与 5 秒切换定时器，需在任务创建之后调用
+static void lcd_events_init(void) {
+    lcd_switch_timer = xTimerCreate("lcd_switch", pdMS_TO_TICKS(5000), pdTRUE, NULL, lcd_switch_timer_cb);
+    xTimerStart(lcd_switch_timer, 0);
+
+    ESP_ERROR_CHECK(gpio_install_isr_service(0));
+    ESP_ERROR_CHECK(gpio_isr_handler_add(EXIT_KEY_PIN, lcd_key_isr, NULL));
+}
+
 // ====================== 9. 主函数 ======================
 void app_main(void) {
     spi_bus_init();
     lcd_init();
-    xTaskCreate(lcd_demo_task, "lcd_demo_task", 4096, NULL, 1, NULL);
+    xTaskCreate(lcd_demo_task, "lcd_demo_task", 4096, NULL, 1, &lcd_task_handle);
+    lcd_events_init();
     ESP_LOGI(TAG, "P3PLUS LCD演示程序启动完成");
 }
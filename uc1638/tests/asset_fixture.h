@@ -0,0 +1,28 @@
+// asset_fixture: 100x37, 380 bytes (raw 500 bytes, 76.0%)
+// generated by tools/uc1638_asset_enc.py
+static const uint8_t asset_fixture[380] = {
+    0x64,0x05,0x00,0x00,0x41,0x00,0x82,0x00,0xD0,0x00,0x2A,0x01,0x00,0xFF,0x81,0x01,
+    0xA2,0xF1,0x82,0x01,0x37,0xA1,0x51,0xA1,0x51,0xA1,0x51,0xA1,0x51,0xA1,0x51,0xA1,
+    0x51,0xA1,0x51,0xA1,0x51,0xA1,0x51,0xA1,0x51,0xA1,0x51,0xA1,0x51,0xA1,0x51,0xA1,
+    0x51,0x01,0x01,0x4D,0xBD,0xF1,0x0D,0x3D,0x01,0xC1,0x9D,0x95,0x81,0x1D,0x2D,0x85,
+    0x3D,0x6D,0x29,0xE5,0xA1,0xAD,0x09,0x29,0x81,0x11,0x01,0x01,0xFF,0x00,0xFF,0x81,
+    0x00,0xA2,0xFF,0x82,0x00,0x37,0xAA,0x55,0xAA,0x55,0xAA,0x55,0xAA,0x55,0xAA,0x55,
+    0xAA,0x55,0xAA,0x55,0xAA,0x55,0xAA,0x55,0xAA,0x55,0xAA,0x55,0xAA,0x55,0xAA,0x55,
+    0xAA,0x55,0x00,0x00,0xE2,0x03,0x21,0x4B,0x27,0x54,0x44,0x67,0x54,0x2A,0x1B,0x26,
+    0x39,0x37,0x55,0xFD,0x45,0x19,0xA4,0x50,0x02,0x44,0xFA,0x00,0x00,0xFF,0x00,0xFF,
+    0x81,0x00,0x01,0x4F,0x8F,0x88,0x0F,0x01,0x4F,0x8F,0x88,0x0F,0x01,0x4F,0x8F,0x88,
+    0x0F,0x82,0x00,0x37,0xAA,0x55,0xAA,0x55,0xAA,0x55,0xAA,0x55,0xAA,0x55,0xAA,0x55,
+    0xAA,0x55,0xAA,0x55,0xAA,0x55,0xAA,0x55,0xAA,0x55,0xAA,0x55,0xAA,0x55,0xAA,0x55,
+    0x00,0x00,0x6A,0x24,0x44,0x19,0x45,0x29,0x52,0x5A,0x7F,0x34,0x0E,0x0A,0xB2,0x83,
+    0xBB,0x27,0xDB,0x82,0xB6,0x06,0x94,0xE4,0x85,0x00,0x00,0xFF,0x00,0xFF,0x83,0x00,
+    0x07,0x01,0x02,0x04,0x08,0x10,0x20,0x40,0x80,0x82,0x00,0x07,0x01,0x02,0x04,0x08,
+    0x10,0x20,0x40,0x80,0x82,0x00,0x03,0x01,0x02,0x04,0x08,0x88,0x00,0x37,0xAA,0x55,
+    0xAA,0x55,0xAA,0x55,0xAA,0x55,0xAA,0x55,0xAA,0x55,0xAA,0x55,0xAA,0x55,0xAA,0x55,
+    0xAA,0x55,0xAA,0x55,0xAA,0x55,0xAA,0x55,0xAA,0x55,0x00,0x00,0xB0,0x64,0x10,0xEB,
+    0x20,0xE0,0x05,0x21,0x2D,0x2A,0x03,0x48,0x32,0x8D,0xC2,0x68,0x6E,0x21,0x22,0x94,
+    0xC0,0x62,0x71,0x00,0x00,0xFF,0x00,0x1F,0x8B,0x10,0x01,0x11,0x12,0x88,0x10,0x01,
+    0x11,0x12,0x8F,0x10,0x1A,0x11,0x10,0x11,0x10,0x11,0x10,0x11,0x10,0x11,0x10,0x11,
+    0x10,0x11,0x10,0x11,0x10,0x11,0x10,0x11,0x10,0x11,0x10,0x11,0x10,0x11,0x10,0x11,
+    0x81,0x10,0x18,0x11,0x13,0x16,0x16,0x13,0x14,0x10,0x13,0x10,0x12,0x16,0x12,0x11,
+    0x10,0x12,0x16,0x14,0x10,0x10,0x15,0x11,0x12,0x10,0x10,0x1F,
+};
@@ -0,0 +1,144 @@
+/*
+ * emu.c
+ * 主机测试用 UC1638 模型与 HAL 桩
+ */
+
+#include "emu.h"
+#include "uc1638.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+GPIO_TypeDef emu_gpio;
+SPI_HandleTypeDef hspi1;
+UART_HandleTypeDef huart1;
+
+uint8_t emu_ram[EMU_PAGES][EMU_COLS];
+long emu_bytes = 0;
+long emu_xfers = 0;
+uint32_t emu_tick = 0;
+uint8_t emu_dma_async = 0;
+
+static int s_A0 = 0;
+static int s_CS = 1;
+static int s_Page = 0;
+static int s_Col = 0;
+static int s_Map = 0xC4;
+static int s_Write = 0;         // 0x01 之后的数据写入显存
+static int s_Param = 0;         // 等待参数字节的双字节命令
+static int s_WinC1 = 0;
+static int s_WinC2 = EMU_COLS - 1;
+
+static const uint8_t *s_DmaData;
+static long s_DmaLeft = 0;
+
+/* ================= 控制器 ================= */
+
+static void emu_byte(uint8_t b) {
+    emu_bytes++;
+
+    if (!s_A0) {
+        s_Write = 0;
+        s_Param = 0;
+        if ((b & 0xF0) == 0x60) { s_Page = (s_Page & 0xF0) | (b & 0x0F); return; }
+        if ((b & 0xF0) == 0x70) { s_Page = (s_Page & 0x0F) | ((b & 0x0F) << 4); return; }
+        if ((b & 0xF8) == 0xC0) { s_Map = b; return; }
+        if (b == 0x01) { s_Write = 1; return; }
+        // 带一个参数字节 (A0 = 1) 的命令
+        if (b == 0x04 || b == 0x81 || b == 0xB8 || b == 0xC8 || b == 0xC9 ||
+            b == 0xF1 || b == 0xF4 || b == 0xF5 || b == 0xF6 || b == 0xF7) {
+            s_Param = b;
+        }
+        return;
+    }
+
+    if (s_Param) {
+        if (s_Param == 0x04) s_Col = b;
+        if (s_Param == 0xF4) s_WinC1 = b;
+        if (s_Param == 0xF6) s_WinC2 = b;
+        s_Param = 0;
+        return;
+    }
+
+    if (s_Write) {
+        if (s_Page < EMU_PAGES && s_Col < EMU_COLS) emu_ram[s_Page][s_Col] = b;
+        // 窗口程序：列到达窗口末尾时折返并进入下一页
+        if (++s_Col > s_WinC2) {
+            s_Col = s_WinC1;
+            if (++s_Page >= LCD_PAGES) s_Page = 0;
+        }
+    }
+}
+
+int emu_pixel(int x, int y) {
+    int mx = (s_Map & 0x02) != 0;
+    int my = ((s_Map ^ 0xC4) & 0x04) != 0;
+    int seg = LCD_COL_OFFSET + x;
+    int col = mx ? UC1638_SEG_NUM - 1 - seg : seg;
+    int row = my ? LCD_HEIGHT - 1 - y : y;
+    return (emu_ram[row >> 3][col] >> (row & 7)) & 1;
+}
+
+/* ================= HAL 桩 ================= */
+
+void HAL_GPIO_WritePin(GPIO_TypeDef *port, uint16_t pin, int state) {
+    (void)port;
+    if (pin == LCD_A0_Pin) s_A0 = state;
+    if (pin == LCD_CS_Pin) s_CS = state;
+}
+
+void HAL_Delay(uint32_t ms) {
+    emu_tick += ms;
+}
+
+uint32_t HAL_GetTick(void) {
+    return emu_tick;
+}
+
+HAL_StatusTypeDef HAL_SPI_Transmit(SPI_HandleTypeDef *h, uint8_t *data, uint16_t len, uint32_t timeout) {
+    (void)h;
+    (void)timeout;
+    if (s_CS) fprintf(stderr, "emu: SPI transfer without CS\n");
+    if (s_DmaLeft) fprintf(stderr, "emu: SPI transfer while DMA is running\n");
+    emu_xfers++;
+    for (uint16_t i = 0; i < len; i++) emu_byte(data[i]);
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_SPI_Transmit_DMA(SPI_HandleTypeDef *h, uint8_t *data, uint16_t len) {
+    (void)h;
+    if (s_DmaLeft) return HAL_BUSY;
+    emu_xfers++;
+    s_DmaData = data;
+    s_DmaLeft = len;
+    if (!emu_dma_async) emu_dma_run(len);
+    return HAL_OK;
+}
+
+long emu_dma_pending(void) {
+    return s_DmaLeft;
+}
+
+void emu_dma_run(long n) {
+    if (!s_DmaLeft) return;
+    while (n-- > 0 && s_DmaLeft > 0) {
+        emu_byte(*s_DmaData++);
+        s_DmaLeft--;
+    }
+    if (s_DmaLeft == 0) UC1638_SPI_TxCpltHandler();
+}
+
+// 默认直接丢弃；需要检查串口输出的测试自行定义
+__weak HAL_StatusTypeDef HAL_UART_Transmit_DMA(UART_HandleTypeDef *h, uint8_t *data, uint16_t len) {
+    (void)h;
+    (void)data;
+    (void)len;
+    return HAL_OK;
+}
+
+double emu_now_us(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e6 + ts.tv_nsec / 1e3;
+}
@@ -0,0 +1,32 @@
+/*
+ * emu.h
+ * 主机测试用 UC1638 模型：解析 SPI 命令/数据流，维护控制器 RAM，
+ * 按 Map Control 与列偏移还原面板上看到的像素
+ */
+
+#ifndef __EMU_H
+#define __EMU_H
+
+#include <stdint.h>
+#include "main.h"
+
+#define EMU_PAGES   20
+#define EMU_COLS    240
+
+extern uint8_t emu_ram[EMU_PAGES][EMU_COLS];
+extern long emu_bytes;          // SPI 总字节数 (命令 + 数据)
+extern long emu_xfers;          // HAL_SPI_Transmit* 调用次数
+extern uint32_t emu_tick;       // HAL_GetTick / HAL_Delay 使用的毫秒计数
+extern uint8_t emu_dma_async;   // 1 = DMA 不立即完成，由 emu_dma_run 推进
+
+// 面板第 y 行第 x 列 (物理方向) 当前显示的像素
+int emu_pixel(int x, int y);
+
+// 异步 DMA：剩余字节数；推进 n 字节 (按推进时刻的内存内容送入控制器)，结束时调用 UC1638_SPI_TxCpltHandler
+long emu_dma_pending(void);
+void emu_dma_run(long n);
+
+// 微秒计时，用于基准测试
+double emu_now_us(void);
+
+#endif /* __EMU_H */
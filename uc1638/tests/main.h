@@ -0,0 +1,36 @@
+/*
+ * main.h (主机测试用)
+ * 替代 CubeMX 生成的 main.h：只声明驱动用到的 HAL 类型与函数，由 emu.c 实现
+ */
+
+#ifndef __MAIN_H
+#define __MAIN_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+typedef struct { int dummy; } SPI_HandleTypeDef;
+typedef struct { int dummy; } UART_HandleTypeDef;
+typedef struct { int dummy; } GPIO_TypeDef;
+typedef enum { HAL_OK = 0, HAL_ERROR, HAL_BUSY, HAL_TIMEOUT } HAL_StatusTypeDef;
+
+#define GPIO_PIN_RESET      0
+#define GPIO_PIN_SET        1
+#define __weak              __attribute__((weak))
+
+extern GPIO_TypeDef emu_gpio;
+#define LCD_CS_GPIO_Port    (&emu_gpio)
+#define LCD_RST_GPIO_Port   (&emu_gpio)
+#define LCD_A0_GPIO_Port    (&emu_gpio)
+#define LCD_CS_Pin          0x01
+#define LCD_RST_Pin         0x02
+#define LCD_A0_Pin          0x04
+
+void HAL_GPIO_WritePin(GPIO_TypeDef *port, uint16_t pin, int state);
+HAL_StatusTypeDef HAL_SPI_Transmit(SPI_HandleTypeDef *h, uint8_t *data, uint16_t len, uint32_t timeout);
+HAL_StatusTypeDef HAL_SPI_Transmit_DMA(SPI_HandleTypeDef *h, uint8_t *data, uint16_t len);
+HAL_StatusTypeDef HAL_UART_Transmit_DMA(UART_HandleTypeDef *h, uint8_t *data, uint16_t len);
+void HAL_Delay(uint32_t ms);
+uint32_t HAL_GetTick(void);
+
+#endif /* __MAIN_H */
@@ -0,0 +1,221 @@
+/*
+ * test_asset.c
+ * 压缩图像资源：asset_fixture.h 由 tools/uc1638_asset_enc.py 从 asset_fixture.pbm 生成，
+ * 解码结果与 PBM 原图逐像素比较 (整幅 / 子区域 / 非页对齐 / 负坐标 / 裁剪与原点 / 直写 SPI)，
+ * 并与按页 memcpy 原始位图比较解码速度
+ */
+
+#include "uc1638.h"
+#include "uc1638_asset.h"
+#include "emu.h"
+#include "asset_fixture.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define IMG_W   256
+#define IMG_H   256
+
+static int s_W, s_H;
+static uint8_t s_Img[IMG_H][IMG_W];
+static uint8_t s_Raw[LCD_PAGES * LCD_WIDTH];   // 与资源同布局的未压缩页数据
+
+// 读取 P1 (ASCII) PBM
+static int LoadPbm(const char *path) {
+    FILE *f = fopen(path, "r");
+    char line[256];
+    int n = 0, c;
+
+    if (!f) return 0;
+    if (!fgets(line, sizeof(line), f) || strncmp(line, "P1", 2) != 0) {
+        fclose(f);
+        return 0;
+    }
+    do {
+        if (!fgets(line, sizeof(line), f)) {
+            fclose(f);
+            return 0;
+        }
+    } while (line[0] == '#');
+    if (sscanf(line, "%d %d", &s_W, &s_H) != 2 || s_W > IMG_W || s_H > IMG_H) {
+        fclose(f);
+        return 0;
+    }
+    while (n < s_W * s_H && (c = fgetc(f)) != EOF) {
+        if (c == '0' || c == '1') {
+            s_Img[n / s_W][n % s_W] = (uint8_t)(c - '0');
+            n++;
+        }
+    }
+    fclose(f);
+    return n == s_W * s_H;
+}
+
+static int GetPixel(int x, int y) {
+    return (UC1638_GetBuffer()[(y >> 3) * LCD_WIDTH + x] >> (y & 7)) & 1;
+}
+
+// 源图 (u, v) 处的像素，补白的行为 0
+static int Src(int u, int v) {
+    return (v < s_H) ? s_Img[v][u] : 0;
+}
+
+// 在随机背景上绘制子区域，逐像素与原图比较；返回不符的像素数
+static int CheckRegion(int sx, int sp, int w, int np, int x, int y, const UC1638_Rect_t *clip, int ox, int oy) {
+    static uint8_t bg[LCD_PAGES * LCD_WIDTH];
+    int pages = (s_H + 7) / 8;
+    int fails = 0;
+    int ax = x + ox, ay = y + oy;
+
+    for (int i = 0; i < (int)sizeof(bg); i++) bg[i] = (uint8_t)rand();
+    memcpy(UC1638_GetBuffer(), bg, sizeof(bg));
+
+    if (clip) UC1638_SetClip(clip->x1, clip->y1, clip->x2, clip->y2);
+    UC1638_Translate(ox, oy);
+    UC1638_Asset_DrawRegion(asset_fixture, sx, sp, w, np, x, y);
+    UC1638_ResetClip();
+
+    for (int yy = 0; yy < LCD_HEIGHT; yy++) {
+        for (int xx = 0; xx < LCD_WIDTH; xx++) {
+            int u = sx + xx - ax;
+            int v = sp * 8 + yy - ay;
+            int expect = (bg[(yy >> 3) * LCD_WIDTH + xx] >> (yy & 7)) & 1;
+
+            if (xx >= ax && xx < ax + w && yy >= ay && yy < ay + np * 8 &&
+                u >= 0 && u < s_W && v >= 0 && v < pages * 8 &&
+                (!clip || (xx >= clip->x1 && xx <= clip->x2 && yy >= clip->y1 && yy <= clip->y2))) {
+                expect = Src(u, v);
+            }
+            if (GetPixel(xx, yy) != expect) fails++;
+        }
+    }
+    return fails;
+}
+
+static int CheckDraw(void) {
+    int pages = (s_H + 7) / 8;
+    int whole = 0, region = 0, clipped = 0;
+
+    for (int t = 0; t < 500; t++) {
+        whole += CheckRegion(0, 0, s_W, pages, rand() % 200 - 100, rand() % 200 - 80, NULL, 0, 0);
+    }
+    for (int t = 0; t < 1000; t++) {
+        int sx = rand() % (s_W + 20) - 10, sp = rand() % (pages + 2) - 1;
+        region += CheckRegion(sx, sp, rand() % 80 + 1, rand() % 4 + 1, rand() % 160 - 30, rand() % 160 - 30, NULL, 0, 0);
+    }
+    for (int t = 0; t < 1000; t++) {
+        UC1638_Rect_t c;
+        int sx = rand() % s_W, sp = rand() % pages;
+        c.x1 = rand() % 128;
+        c.y1 = rand() % 128;
+        c.x2 = c.x1 + rand() % 80;
+        c.y2 = c.y1 + rand() % 80;
+        if (c.x2 > LCD_WIDTH - 1) c.x2 = LCD_WIDTH - 1;
+        if (c.y2 > LCD_HEIGHT - 1) c.y2 = LCD_HEIGHT - 1;
+        clipped += CheckRegion(sx, sp, rand() % 100 + 1, rand() % 5 + 1, rand() % 140 - 20, rand() % 140 - 20,
+                               &c, rand() % 21 - 10, rand() % 21 - 10);
+    }
+
+    printf("draw whole (unaligned, negative): %s (%d px)\n", whole ? "FAIL" : "ok", whole);
+    printf("draw region (sprite sheet):       %s (%d px)\n", region ? "FAIL" : "ok", region);
+    printf("draw with clip + origin:          %s (%d px)\n", clipped ? "FAIL" : "ok", clipped);
+    return whole + region + clipped;
+}
+
+// 直写 SPI：面板上出现资源、显存不变；90 度时退化为经显存刷新
+static int CheckStream(void) {
+    static uint8_t before[LCD_PAGES * LCD_WIDTH];
+    int pages = (s_H + 7) / 8;
+    int fails = 0;
+
+    for (int t = 0; t < 200; t++) {
+        int x = rand() % 160 - 60, page = rand() % 20 - 4;
+
+        UC1638_Clear(COLOR_WHITE);
+        UC1638_Flush();
+        memcpy(before, UC1638_GetBuffer(), sizeof(before));
+        UC1638_Asset_Stream(asset_fixture, x, page);
+        if (memcmp(before, UC1638_GetBuffer(), sizeof(before)) != 0) fails++;
+
+        for (int yy = 0; yy < LCD_HEIGHT; yy++) {
+            for (int xx = 0; xx < LCD_WIDTH; xx++) {
+                int u = xx - x, v = yy - page * 8;
+                int expect = (u >= 0 && u < s_W && v >= 0 && v < pages * 8) ? Src(u, v) : 0;
+                if (emu_pixel(xx, yy) != expect) fails++;
+            }
+        }
+    }
+    printf("stream to SPI:                    %s (%d px)\n", fails ? "FAIL" : "ok", fails);
+
+    // 90 度：与 UC1638_Asset_Draw 的结果一致
+    UC1638_SetRotation(UC1638_ROTATE_90);
+    UC1638_Clear(COLOR_WHITE);
+    UC1638_Asset_Stream(asset_fixture, 10, 3);
+    memcpy(before, UC1638_GetBuffer(), sizeof(before));
+    UC1638_Clear(COLOR_WHITE);
+    UC1638_Asset_Draw(asset_fixture, 10, 24);
+    if (memcmp(before, UC1638_GetBuffer(), sizeof(before)) != 0) {
+        printf("stream at 90 deg: FAIL\n");
+        fails++;
+    }
+    UC1638_SetRotation(UC1638_ROTATE_0);
+    return fails;
+}
+
+// 解码进显存 vs 按页 memcpy 未压缩位图 (同样的字节数)
+static void Bench(void) {
+    uint8_t *buf = UC1638_GetBuffer();
+    int pages = (s_H + 7) / 8;
+    const int loops = 200000;
+    volatile uint8_t sink = 0;
+    double t0, t_dec, t_unaligned, t_copy;
+
+    for (int p = 0; p < pages; p++) {
+        for (int u = 0; u < s_W; u++) {
+            uint8_t v = 0;
+            for (int b = 0; b < 8; b++) v |= (uint8_t)(Src(u, p * 8 + b) << b);
+            s_Raw[p * s_W + u] = v;
+        }
+    }
+
+    t0 = emu_now_us();
+    for (int k = 0; k < loops; k++) UC1638_Asset_Draw(asset_fixture, 8, 16);
+    t_dec = (emu_now_us() - t0) / loops;
+
+    t0 = emu_now_us();
+    for (int k = 0; k < loops; k++) UC1638_Asset_Draw(asset_fixture, 8, 19);
+    t_unaligned = (emu_now_us() - t0) / loops;
+
+    t0 = emu_now_us();
+    for (int k = 0; k < loops; k++) {
+        for (int p = 0; p < pages; p++) memcpy(&buf[(2 + p) * LCD_WIDTH + 8], &s_Raw[p * s_W], s_W);
+        UC1638_MarkDirty(8, 16, 8 + s_W - 1, 16 + pages * 8 - 1);
+        sink ^= buf[k & 0x7FF];
+    }
+    t_copy = (emu_now_us() - t0) / loops;
+    (void)sink;
+
+    printf("bench %dx%d, %u B encoded / %d B raw: decode %.3f us (y%%8 != 0: %.3f us), memcpy raw %.3f us (x%.2f)\n",
+           s_W, pages * 8, (unsigned)sizeof(asset_fixture), s_W * pages, t_dec, t_unaligned, t_copy, t_copy / t_dec);
+}
+
+int main(void) {
+    int fails;
+
+    if (!LoadPbm("asset_fixture.pbm")) {
+        printf("cannot read asset_fixture.pbm\n");
+        return 1;
+    }
+    if (UC1638_Asset_Width(asset_fixture) != s_W || UC1638_Asset_Height(asset_fixture) != (s_H + 7) / 8 * 8) {
+        printf("fixture header: FAIL\n");
+        return 1;
+    }
+
+    UC1638_Init();
+    srand(28);
+    fails = CheckDraw();
+    fails += CheckStream();
+    Bench();
+    return fails != 0;
+}
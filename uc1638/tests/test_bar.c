@@ -0,0 +1,145 @@
+/*
+ * test_bar.c
+ * 电平条：随机数值序列的增量结果与同数值的整体绘制一致，改动的像素都落在返回的脏区内，
+ * 并统计 1 像素变化后 FlushDirty 的 SPI 字节数
+ */
+
+#include "uc1638.h"
+#include "uc1638_bar.h"
+#include "emu.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+typedef struct {
+    int x, y, w, h, dir, max;
+    int border, seg, gap, ticks, tick_len, inverse;
+} BarCfg_t;
+
+static uint8_t s_Before[LCD_PAGES * LCD_WIDTH];
+static uint8_t s_After[LCD_PAGES * LCD_WIDTH];
+
+static int BufPixel(const uint8_t *buf, int x, int y) {
+    return (buf[(y >> 3) * LCD_WIDTH + x] >> (y & 7)) & 1;
+}
+
+static void RandomCfg(BarCfg_t *c) {
+    c->dir = rand() & 1;
+    c->x = rand() % 60 - 5;
+    c->y = rand() % 60 - 5;
+    c->w = c->dir ? 4 + rand() % 20 : 10 + rand() % 100;
+    c->h = c->dir ? 10 + rand() % 100 : 4 + rand() % 20;
+    c->max = 1 + rand() % 1000;
+    c->border = rand() & 1;
+    c->seg = (rand() & 1) ? 1 + rand() % 5 : 0;
+    c->gap = 1 + rand() % 3;
+    c->ticks = (rand() & 1) ? 2 + rand() % 9 : 0;
+    c->tick_len = 1 + rand() % 3;
+    c->inverse = rand() % 4 == 0;
+}
+
+static void MakeBar(UC1638_Bar_t *bar, const BarCfg_t *c) {
+    UC1638_Bar_Init(bar, c->x, c->y, c->w, c->h, (UC1638_BarDir_t)c->dir, c->max);
+    UC1638_Bar_SetBorder(bar, c->border);
+    UC1638_Bar_SetSegments(bar, c->seg, c->gap);
+    UC1638_Bar_SetTicks(bar, c->ticks, c->tick_len);
+    UC1638_Bar_SetInverse(bar, c->inverse);
+}
+
+static int CheckRandom(void) {
+    long updates = 0, mismatches = 0, outside = 0;
+    uint8_t *buf = UC1638_GetBuffer();
+
+    for (int t = 0; t < 3000; t++) {
+        BarCfg_t cfg;
+        UC1638_Bar_t bar, ref;
+        int clipped = rand() % 3 == 0;
+        int cx = rand() % 128, cy = rand() % 128;
+
+        RandomCfg(&cfg);
+        MakeBar(&bar, &cfg);
+        UC1638_Bar_SetValue(&bar, rand() % (cfg.max + 1), NULL);
+        UC1638_Clear(COLOR_WHITE);
+        if (clipped) UC1638_SetClip(cx - 40, cy - 40, cx + 40, cy + 40);
+        UC1638_Bar_Draw(&bar);
+
+        for (int s = 0; s < 30; s++) {
+            int v = (rand() % 3) ? bar.value + rand() % 21 - 10 : rand() % (cfg.max + 50) - 20;
+            UC1638_Rect_t d;
+            uint8_t changed;
+
+            memcpy(s_Before, buf, sizeof(s_Before));
+            changed = UC1638_Bar_SetValue(&bar, v, &d);
+            updates++;
+
+            for (int y = 0; y < LCD_HEIGHT; y++) {
+                for (int x = 0; x < LCD_WIDTH; x++) {
+                    int in = changed && x >= d.x1 && x <= d.x2 && y >= d.y1 && y <= d.y2;
+                    if (BufPixel(s_Before, x, y) != BufPixel(buf, x, y) && !in) outside++;
+                }
+            }
+
+            // 同一数值整体绘制一次作为参考
+            memcpy(s_After, buf, sizeof(s_After));
+            MakeBar(&ref, &cfg);
+            UC1638_Bar_SetValue(&ref, bar.value, NULL);
+            UC1638_Clear(COLOR_WHITE);
+            UC1638_Bar_Draw(&ref);
+            if (memcmp(s_After, buf, sizeof(s_After)) != 0) mismatches++;
+            memcpy(buf, s_After, sizeof(s_After));
+        }
+        UC1638_ResetClip();
+    }
+    printf("incremental vs full draw: %s (%ld of %ld updates differ, %ld px outside dirty)\n",
+           (mismatches || outside) ? "FAIL" : "ok", mismatches, updates, outside);
+    return (int)(mismatches + outside);
+}
+
+static void StepCost(const char *name, UC1638_Bar_t *bar, int to) {
+    long bytes = emu_bytes;
+    UC1638_Rect_t d;
+
+    UC1638_Bar_SetValue(bar, to, &d);
+    UC1638_FlushDirty();
+    printf("1 px step %-18s dirty (%d,%d)-(%d,%d), %ld SPI bytes\n", name, d.x1, d.y1, d.x2, d.y2, emu_bytes - bytes);
+}
+
+int main(void) {
+    UC1638_Bar_t h, v, sg;
+    int fails;
+    long bytes;
+
+    UC1638_Init();
+    srand(38);
+    fails = CheckRandom();
+
+    UC1638_Clear(COLOR_WHITE);
+    UC1638_Bar_Init(&h, 4, 20, 120, 12, UC1638_BAR_HORIZONTAL, 116);
+    UC1638_Bar_SetTicks(&h, 11, 3);
+    UC1638_Bar_SetValue(&h, 50, NULL);
+    UC1638_Bar_Draw(&h);
+    UC1638_Bar_Init(&v, 100, 40, 14, 80, UC1638_BAR_VERTICAL, 76);
+    UC1638_Bar_SetValue(&v, 30, NULL);
+    UC1638_Bar_Draw(&v);
+    UC1638_Bar_Init(&sg, 4, 60, 90, 10, UC1638_BAR_HORIZONTAL, 100);
+    UC1638_Bar_SetSegments(&sg, 6, 2);
+    UC1638_Bar_SetValue(&sg, 40, NULL);
+    UC1638_Bar_Draw(&sg);
+    UC1638_Flush();
+
+    StepCost("horizontal 120x12", &h, 51);
+    StepCost("vertical 14x80", &v, 31);
+    StepCost("segmented 6+2", &sg, 52);
+
+    // 对照：整条重绘 + 整屏刷新
+    bytes = emu_bytes;
+    UC1638_Bar_Init(&h, 4, 20, 120, 12, UC1638_BAR_HORIZONTAL, 116);
+    UC1638_Bar_SetTicks(&h, 11, 3);
+    UC1638_Bar_SetValue(&h, 52, NULL);
+    UC1638_Bar_Draw(&h);
+    UC1638_Flush();
+    printf("full redraw + Flush:         %ld SPI bytes\n", emu_bytes - bytes);
+
+    return fails != 0;
+}
@@ -0,0 +1,136 @@
+/*
+ * test_dither.c
+ * 抖动输出与参考实现逐像素比对 (随机位置/尺寸，含越界、裁剪区与原点平移)，并测量每秒可转换的行数
+ */
+
+#include "uc1638.h"
+#include "uc1638_dither.h"
+#include "emu.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define IMG_MAX     160
+
+static const uint8_t s_Bayer8[8][8] = {
+    { 0, 32,  8, 40,  2, 34, 10, 42},
+    {48, 16, 56, 24, 50, 18, 58, 26},
+    {12, 44,  4, 36, 14, 46,  6, 38},
+    {60, 28, 52, 20, 62, 30, 54, 22},
+    { 3, 35, 11, 43,  1, 33,  9, 41},
+    {51, 19, 59, 27, 49, 17, 57, 25},
+    {15, 47,  7, 39, 13, 45,  5, 37},
+    {63, 31, 55, 23, 61, 29, 53, 21}
+};
+
+static uint8_t s_Img[IMG_MAX * IMG_MAX];
+static uint8_t s_Ref[IMG_MAX][IMG_MAX];
+
+static int GetPixel(int x, int y) {
+    return (UC1638_GetBuffer()[(y >> 3) * LCD_WIDTH + x] >> (y & 7)) & 1;
+}
+
+// 逐像素参考实现：误差只在可见列之间扩散 (与驱动一致)
+static void Reference(int x, int y, int w, int h, int mode) {
+    static int err[2][IMG_MAX + 2];
+    int c0 = (x < 0) ? -x : 0;
+    int cur = 0;
+
+    memset(err, 0, sizeof(err));
+    for (int r = 0; r < h; r++) {
+        for (int c = c0; c < w && x + c < LCD_WIDTH; c++) {
+            int k = c - c0;
+            int v = s_Img[r * w + c];
+            if (mode == UC1638_DITHER_BAYER) {
+                s_Ref[r][c] = v < s_Bayer8[(y + r) & 7][(x + c) & 7] * 4 + 2;
+            } else {
+                int e;
+                v += (err[cur][k + 1] + 8) >> 4;
+                s_Ref[r][c] = v < 128;
+                e = s_Ref[r][c] ? v : v - 255;
+                err[cur][k + 2] += e * 7;
+                err[cur ^ 1][k] += e * 3;
+                err[cur ^ 1][k + 1] += e * 5;
+                err[cur ^ 1][k + 2] += e;
+            }
+        }
+        memset(err[cur], 0, sizeof(err[0]));
+        cur ^= 1;
+    }
+}
+
+int main(void) {
+    int fails = 0;
+
+    UC1638_Init();
+    srand(29);
+
+    for (int t = 0; t < 200; t++) {
+        int w = rand() % 150 + 1, h = rand() % 150 + 1;
+        int x = rand() % 160 - 30, y = rand() % 160 - 30;
+        int mode = rand() & 1, bg = rand() & 1;
+
+        for (int r = 0; r < h; r++) {
+            for (int c = 0; c < w; c++) s_Img[r * w + c] = (t & 1) ? c * 255 / w : rand() & 0xFF;
+        }
+        UC1638_Clear(bg ? COLOR_BLACK : COLOR_WHITE);
+        UC1638_Dither_Image(x, y, w, h, s_Img, w, (UC1638_DitherMode_t)mode);
+        Reference(x, y, w, h, mode);
+
+        for (int yy = 0; yy < LCD_HEIGHT; yy++) {
+            for (int xx = 0; xx < LCD_WIDTH; xx++) {
+                int u = xx - x, v = yy - y;
+                int expect = (u >= 0 && u < w && v >= 0 && v < h) ? s_Ref[v][u] : bg;
+                if (GetPixel(xx, yy) != expect) fails++;
+            }
+        }
+    }
+    printf("dither vs reference: %s (%d px)\n", fails ? "FAIL" : "ok", fails);
+
+    // 裁剪区 + 原点：区内与整幅绘制一致，区外保持背景
+    {
+        int clip_fails = 0;
+        for (int t = 0; t < 200; t++) {
+            int w = rand() % 100 + 1, h = rand() % 100 + 1;
+            int x = rand() % 120 - 20, y = rand() % 120 - 20;
+            int dx = rand() % 21 - 10, dy = rand() % 21 - 10;
+            int cx1 = rand() % 128, cy1 = rand() % 128;
+            int cx2 = cx1 + rand() % 64, cy2 = cy1 + rand() % 64;
+            int mode = rand() & 1, bg = rand() & 1;
+
+            for (int i = 0; i < w * h; i++) s_Img[i] = rand() & 0xFF;
+            UC1638_Clear(bg ? COLOR_BLACK : COLOR_WHITE);
+            UC1638_SetClip(cx1, cy1, cx2, cy2);
+            UC1638_Translate(dx, dy);
+            UC1638_Dither_Image(x, y, w, h, s_Img, w, (UC1638_DitherMode_t)mode);
+            UC1638_ResetClip();
+            Reference(x + dx, y + dy, w, h, mode);
+
+            for (int yy = 0; yy < LCD_HEIGHT; yy++) {
+                for (int xx = 0; xx < LCD_WIDTH; xx++) {
+                    int u = xx - x - dx, v = yy - y - dy;
+                    int in = xx >= cx1 && xx <= cx2 && yy >= cy1 && yy <= cy2;
+                    int expect = (in && u >= 0 && u < w && v >= 0 && v < h) ? s_Ref[v][u] : bg;
+                    if (GetPixel(xx, yy) != expect) clip_fails++;
+                }
+            }
+        }
+        printf("dither with clip + origin: %s (%d px)\n", clip_fails ? "FAIL" : "ok", clip_fails);
+        fails += clip_fails;
+    }
+
+    // 吞吐：整屏 128x128 转换
+    for (int i = 0; i < LCD_WIDTH * LCD_HEIGHT; i++) s_Img[i] = rand() & 0xFF;
+    for (int mode = 0; mode < 2; mode++) {
+        const int loops = 2000;
+        double t0 = emu_now_us();
+        for (int k = 0; k < loops; k++) {
+            UC1638_Dither_Image(0, 0, LCD_WIDTH, LCD_HEIGHT, s_Img, LCD_WIDTH, (UC1638_DitherMode_t)mode);
+        }
+        printf("bench %-6s: %.0f rows/s (128 px rows, host)\n", mode ? "floyd" : "bayer",
+               (double)loops * LCD_HEIGHT * 1e6 / (emu_now_us() - t0));
+    }
+
+    return fails != 0;
+}
@@ -0,0 +1,140 @@
+/*
+ * test_label.c
+ * 文字缓存：随机字符串、位置、颜色、裁剪区与原点下 UC1638_Label_Draw 与 UC1638_ShowString
+ * 结果一致 (首次栅格化与命中两条路径)；命中/未命中/淘汰/超长计数与 LRU 淘汰顺序
+ */
+
+#include "uc1638.h"
+#include "uc1638_label.h"
+#include "emu.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static uint8_t s_Bg[LCD_PAGES * LCD_WIDTH];
+static uint8_t s_Expect[LCD_PAGES * LCD_WIDTH];
+
+static void RandomText(char *s, int len) {
+    for (int i = 0; i < len; i++) s[i] = (char)(' ' + rand() % 95);
+    s[len] = 0;
+}
+
+static void Setup(int cx1, int cy1, int cx2, int cy2, int ox, int oy) {
+    UC1638_ResetClip();
+    UC1638_SetClip(cx1, cy1, cx2, cy2);
+    UC1638_Translate(ox, oy);
+}
+
+static int CheckMatch(void) {
+    static char pool[12][24];
+    long cases = 0, fails = 0;
+
+    // 小字符串池保证大量命中，另含超过 UC1638_LABEL_MAX_CHARS 的字符串
+    for (int i = 0; i < 12; i++) RandomText(pool[i], 1 + rand() % (UC1638_LABEL_MAX_CHARS + 4));
+    UC1638_Label_Reset();
+
+    for (int t = 0; t < 3000; t++) {
+        const char *str = pool[rand() % 12];
+        int x = rand() % 160 - 30, y = rand() % 160 - 30;
+        int cx1 = rand() % 128 - 10, cy1 = rand() % 128 - 10;
+        int cx2 = cx1 + rand() % 128, cy2 = cy1 + rand() % 128;
+        int ox = rand() % 21 - 10, oy = rand() % 21 - 10;
+        LCD_Color_t color = (LCD_Color_t)(rand() & 1);
+
+        if (rand() % 4 == 0) {
+            cx1 = -10;
+            cy1 = -10;
+            cx2 = 200;
+            cy2 = 200;
+        }
+        for (int i = 0; i < (int)sizeof(s_Bg); i++) s_Bg[i] = (uint8_t)rand();
+
+        memcpy(UC1638_GetBuffer(), s_Bg, sizeof(s_Bg));
+        Setup(cx1, cy1, cx2, cy2, ox, oy);
+        UC1638_ShowString(x, y, str, color);
+        memcpy(s_Expect, UC1638_GetBuffer(), sizeof(s_Expect));
+
+        memcpy(UC1638_GetBuffer(), s_Bg, sizeof(s_Bg));
+        Setup(cx1, cy1, cx2, cy2, ox, oy);
+        UC1638_Label_Draw(x, y, str, color);
+        cases++;
+        if (memcmp(s_Expect, UC1638_GetBuffer(), sizeof(s_Expect)) != 0) fails++;
+    }
+    UC1638_ResetClip();
+
+    printf("Label_Draw vs ShowString (clip + origin): %s (%ld of %ld differ)\n", fails ? "FAIL" : "ok", fails, cases);
+    return (int)fails;
+}
+
+static int Expect(const char *what, uint32_t got, uint32_t want) {
+    if (got == want) return 0;
+    printf("  %s: %u, expected %u\n", what, (unsigned)got, (unsigned)want);
+    return 1;
+}
+
+// 计数与 LRU：用统计增量判断每次绘制是命中还是未命中
+static int CheckStats(void) {
+    static const char *names[UC1638_LABEL_SLOTS + 1] = {
+        "s0", "s1", "s2", "s3", "s4", "s5", "s6", "s7", "s8"
+    };
+    UC1638_Label_Stats_t a, b;
+    int fails = 0;
+
+    UC1638_Label_Reset();
+    UC1638_Label_GetStats(&a);
+
+    UC1638_Label_Draw(0, 0, "A", COLOR_BLACK);      // 未命中
+    UC1638_Label_Draw(40, 8, "A", COLOR_WHITE);     // 相同相位、不同位置与颜色：命中
+    UC1638_Label_Draw(0, 3, "A", COLOR_BLACK);      // 不同相位：未命中
+    UC1638_Label_Draw(0, 0, "ABCDEFGHIJKLMNOPQ", COLOR_BLACK); // 超长：直接绘制
+    UC1638_Label_GetStats(&b);
+    fails += Expect("hits", b.hits - a.hits, 1);
+    fails += Expect("misses", b.misses - a.misses, 2);
+    fails += Expect("bypass", b.bypass - a.bypass, 1);
+    fails += Expect("evictions", b.evictions - a.evictions, 0);
+    fails += Expect("slots", b.slots_used, 2);
+    fails += Expect("bytes", b.bytes_used, 6 * 2 + 6 * 2); // 相位 0 与 3 都占 2 页
+
+    // 填满全部槽，再访问 s0：下一个新字符串应淘汰最久未使用的 s1
+    UC1638_Label_Reset();
+    for (int i = 0; i < UC1638_LABEL_SLOTS; i++) UC1638_Label_Draw(0, 0, names[i], COLOR_BLACK);
+    UC1638_Label_Draw(0, 0, names[0], COLOR_BLACK);
+    UC1638_Label_GetStats(&a);
+    UC1638_Label_Draw(0, 0, names[UC1638_LABEL_SLOTS], COLOR_BLACK);
+    UC1638_Label_GetStats(&b);
+    fails += Expect("evictions after full", b.evictions - a.evictions, 1);
+    fails += Expect("slots when full", b.slots_used, UC1638_LABEL_SLOTS);
+
+    UC1638_Label_GetStats(&a);
+    UC1638_Label_Draw(0, 0, names[0], COLOR_BLACK); // 最近使用过，仍在缓存
+    UC1638_Label_Draw(0, 0, names[2], COLOR_BLACK); // 未被淘汰
+    UC1638_Label_GetStats(&b);
+    fails += Expect("hits on s0 / s2", b.hits - a.hits, 2);
+
+    UC1638_Label_GetStats(&a);
+    UC1638_Label_Draw(0, 0, names[1], COLOR_BLACK); // 已被淘汰
+    UC1638_Label_GetStats(&b);
+    fails += Expect("miss on evicted s1", b.misses - a.misses, 1);
+    fails += Expect("s1 evicts the next LRU", b.evictions - a.evictions, 1);
+
+    // 此时最久未使用的是 s3：s2 刚访问过，s3 应被 s1 淘汰
+    UC1638_Label_GetStats(&a);
+    UC1638_Label_Draw(0, 0, names[3], COLOR_BLACK);
+    UC1638_Label_Draw(0, 0, names[2], COLOR_BLACK);
+    UC1638_Label_GetStats(&b);
+    fails += Expect("miss on s3, hit on s2", (b.misses - a.misses) * 10 + (b.hits - a.hits), 11);
+
+    printf("hit / miss / eviction / bypass / LRU:    %s\n", fails ? "FAIL" : "ok");
+    return fails;
+}
+
+int main(void) {
+    int fails;
+
+    UC1638_Init();
+    srand(33);
+    fails = CheckMatch();
+    fails += CheckStats();
+    return fails != 0;
+}
@@ -0,0 +1,252 @@
+/*
+ * test_mirror.c
+ * 显存镜像：截获 UART 输出，按 uc1638_mirror.h 的包格式与 RLE 规则解码 (与
+ * tools/uc1638_mirror_dec.py 相同)，检查还原的屏幕与最近一次刷新后的显存一致 (刷新之后再画、
+ * 尚未刷新的内容不应出现)，并按 8N1 估算各波特率下的线路时间
+ */
+
+#include "uc1638.h"
+#include "uc1638_mirror.h"
+#include "emu.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define CAP_SIZE    (4 << 20)
+
+static const long s_Bauds[] = { 115200, 921600 };
+
+/* ================= UART 桩 ================= */
+
+static uint8_t s_Cap[CAP_SIZE];
+static long s_CapLen = 0;
+static int s_TxPolls = 0;   // 剩余多少次 Pump 后发送完成
+
+HAL_StatusTypeDef HAL_UART_Transmit_DMA(UART_HandleTypeDef *h, uint8_t *data, uint16_t len) {
+    (void)h;
+    if (s_TxPolls) return HAL_BUSY;
+    if (s_CapLen + len > CAP_SIZE) return HAL_ERROR;
+    memcpy(&s_Cap[s_CapLen], data, len);
+    s_CapLen += len;
+    s_TxPolls = 1 + rand() % 4;
+    return HAL_OK;
+}
+
+// 模拟主循环一次：推进串口发送，再调用 Poll
+static void Pump(void) {
+    if (s_TxPolls && --s_TxPolls == 0) UC1638_Mirror_TxCpltHandler();
+    UC1638_Mirror_Poll();
+}
+
+// 发完所有积压的变化
+static void Drain(void) {
+    for (int i = 0; i < 64; i++) Pump();
+}
+
+/* ================= 解码 ================= */
+
+typedef struct {
+    uint8_t fb[LCD_PAGES * LCD_WIDTH];
+    int synced;
+    int seq;
+    long pos;           // s_Cap 中已解析到的位置
+    long errors;        // 校验失败、段越界或 RLE 溢出
+    long lost;
+    long packets, keys;
+    long key_bytes, delta_bytes, delta_max;
+} Decoder_t;
+
+static Decoder_t s_Dec;
+static uint8_t s_Flushed[LCD_PAGES * LCD_WIDTH];   // 最近一次刷新后面板上的内容
+
+static int Rle(const uint8_t *src, int len, int *pos, uint8_t *dst, int n) {
+    int out = 0;
+
+    while (out < n) {
+        int c;
+        if (*pos >= len) return 0;
+        c = src[(*pos)++];
+        if (c & 0x80) {
+            int k = (c & 0x7F) + 2;
+            if (out + k > n || *pos >= len) return 0;
+            memset(&dst[out], src[(*pos)++], k);
+            out += k;
+        } else {
+            int k = c + 1;
+            if (out + k > n || *pos + k > len) return 0;
+            memcpy(&dst[out], &src[*pos], k);
+            *pos += k;
+            out += k;
+        }
+    }
+    return 1;
+}
+
+static void Apply(uint8_t type, uint8_t seq, const uint8_t *payload, int len) {
+    int pos = 0;
+
+    if (s_Dec.seq >= 0 && seq != ((s_Dec.seq + 1) & 0xFF)) {
+        s_Dec.lost += (seq - s_Dec.seq - 1) & 0xFF;
+        s_Dec.synced = 0;
+    }
+    s_Dec.seq = seq;
+    if (type == 'K') s_Dec.synced = 1;
+    if (!s_Dec.synced) return;
+
+    while (pos < len) {
+        int page, x, n;
+        if (pos + 3 > len) {
+            s_Dec.errors++;
+            return;
+        }
+        page = payload[pos];
+        x = payload[pos + 1];
+        n = payload[pos + 2];
+        pos += 3;
+        if (page >= LCD_PAGES || x + n > LCD_WIDTH ||
+            !Rle(payload, len, &pos, &s_Dec.fb[page * LCD_WIDTH + x], n)) {
+            s_Dec.errors++;
+            return;
+        }
+    }
+}
+
+// 解析截获缓冲中新到的完整包
+static void Decode(void) {
+    while (s_Dec.pos + 6 < s_CapLen) {
+        const uint8_t *p = &s_Cap[s_Dec.pos];
+        int len = p[4] | (p[5] << 8);
+        uint8_t sum = 0;
+
+        if (p[0] != 0xA5 || p[1] != 0x5A || (p[2] != 'K' && p[2] != 'D')) {
+            s_Dec.errors++;
+            s_Dec.pos++;
+            continue;
+        }
+        if (s_Dec.pos + 6 + len >= s_CapLen) return;
+        for (int i = 2; i < 6 + len; i++) sum += p[i];
+        if (sum != p[6 + len]) {
+            s_Dec.errors++;
+            s_Dec.pos++;
+            continue;
+        }
+
+        Apply(p[2], p[3], p + 6, len);
+        s_Dec.packets++;
+        if (p[2] == 'K') {
+            s_Dec.keys++;
+            s_Dec.key_bytes += len + 7;
+        } else {
+            s_Dec.delta_bytes += len + 7;
+            if (len + 7 > s_Dec.delta_max) s_Dec.delta_max = len + 7;
+        }
+        s_Dec.pos += len + 7;
+    }
+}
+
+/* ================= 场景 ================= */
+
+static void StepCounter(int i) {
+    UC1638_ShowInt(40, 60, i, 5, COLOR_BLACK);
+}
+
+static void StepMixed(int i) {
+    int x = rand() % 120, y = rand() % 120;
+
+    switch (rand() % 4) {
+    case 0: UC1638_Fill(x, y, x + rand() % 20, y + rand() % 12, (LCD_Color_t)(rand() & 1)); break;
+    case 1: UC1638_ShowString(x % 96, y % 116, "12:34", COLOR_BLACK); break;
+    case 2: UC1638_DrawLine(x, y, rand() % 128, rand() % 128, (LCD_Color_t)(rand() & 1)); break;
+    default: UC1638_ShowInt(0, 0, i, 4, COLOR_BLACK); break;
+    }
+}
+
+// 刷新之后再画一笔但不刷新：面板上没有它，镜像也不应发出
+static void StepUnflushed(int i) {
+    StepMixed(i);
+    UC1638_FlushDirty();
+    memcpy(s_Flushed, UC1638_GetBuffer(), sizeof(s_Flushed));
+    UC1638_Fill(rand() % 120, rand() % 120, 127, 127, (LCD_Color_t)(rand() & 1));
+}
+
+static void StepNoise(int i) {
+    uint8_t *buf = UC1638_GetBuffer();
+    (void)i;
+    for (int k = 0; k < LCD_PAGES * LCD_WIDTH; k++) buf[k] = (uint8_t)rand();
+    UC1638_MarkDirty(0, 0, LCD_WIDTH - 1, LCD_HEIGHT - 1);
+}
+
+static int RunScenario(const char *name, void (*step)(int), int steps) {
+    int fails = 0;
+    long packets, keys, deltas, key_bytes, delta_bytes;
+
+    UC1638_Clear(COLOR_WHITE);
+    UC1638_Flush();
+    memcpy(s_Flushed, UC1638_GetBuffer(), sizeof(s_Flushed));
+    Drain();
+    Decode();
+    packets = s_Dec.packets;
+    keys = s_Dec.keys;
+    key_bytes = s_Dec.key_bytes;
+    delta_bytes = s_Dec.delta_bytes;
+    s_Dec.delta_max = 0;
+
+    for (int i = 0; i < steps; i++) {
+        step(i);
+        if (step != StepUnflushed) {
+            UC1638_FlushDirty();
+            memcpy(s_Flushed, UC1638_GetBuffer(), sizeof(s_Flushed));
+        }
+        Pump();
+        // 周期性插入关键帧请求 (上位机重连)
+        if (i % 97 == 96) UC1638_Mirror_RequestKeyframe();
+        if (i % 50 == 49) {
+            Drain();
+            Decode();
+            if (memcmp(s_Dec.fb, s_Flushed, sizeof(s_Dec.fb)) != 0) fails++;
+        }
+    }
+    Drain();
+    Decode();
+    if (memcmp(s_Dec.fb, s_Flushed, sizeof(s_Dec.fb)) != 0) fails++;
+
+    packets = s_Dec.packets - packets;
+    keys = s_Dec.keys - keys;
+    deltas = packets - keys;
+    key_bytes = s_Dec.key_bytes - key_bytes;
+    delta_bytes = s_Dec.delta_bytes - delta_bytes;
+
+    printf("%-9s %s: %ld packets (%ld keyframes), delta avg %.0f B max %ld B\n", name,
+           fails ? "FAIL" : "ok", packets, keys, deltas ? (double)delta_bytes / deltas : 0.0, s_Dec.delta_max);
+    for (unsigned b = 0; b < sizeof(s_Bauds) / sizeof(s_Bauds[0]); b++) {
+        double bps = s_Bauds[b] / 10.0; // 8N1
+        double avg = deltas ? (double)delta_bytes / deltas : 0.0;
+        printf("  %6ld baud: keyframe %6.1f ms, delta %6.2f ms", s_Bauds[b],
+               keys ? 1000.0 * key_bytes / keys / bps : 0.0, 1000.0 * avg / bps);
+        if (avg > 0) printf(" (max %.0f updates/s)", bps / avg);
+        printf("\n");
+    }
+    return fails;
+}
+
+int main(void) {
+    int fails = 0;
+
+    UC1638_Init();
+    srand(36);
+    memset(&s_Dec, 0, sizeof(s_Dec));
+    s_Dec.seq = -1;
+    UC1638_Mirror_Init();
+
+    fails += RunScenario("counter", StepCounter, 400);
+    fails += RunScenario("mixed", StepMixed, 400);
+    fails += RunScenario("unflushed", StepUnflushed, 400);
+    fails += RunScenario("noise", StepNoise, 100);
+
+    if (s_Dec.errors || s_Dec.lost || !s_Dec.synced) {
+        printf("stream: FAIL (%ld errors, %ld lost)\n", s_Dec.errors, s_Dec.lost);
+        fails++;
+    }
+    return fails != 0;
+}
@@ -0,0 +1,106 @@
+/*
+ * test_rotation.c
+ * 4 个方向 x 4 种镜像逐像素比对面板内容，并测量 90/270 度刷新中 8x8 转置的开销
+ * 切换方向/镜像后只调用 FlushDirty，同样要求面板内容正确
+ */
+
+#include "uc1638.h"
+#include "emu.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+static uint8_t s_Ref[LCD_HEIGHT][LCD_WIDTH];
+
+// 面板 (x, y) 应显示的逻辑像素：先撤销镜像，再按顺时针旋转换算
+static int ExpectedPixel(int x, int y, int rot, int mirror) {
+    int px = (mirror & 1) ? LCD_WIDTH - 1 - x : x;
+    int py = (mirror & 2) ? LCD_HEIGHT - 1 - y : y;
+
+    switch (rot) {
+        case UC1638_ROTATE_90:  return s_Ref[LCD_WIDTH - 1 - px][py];
+        case UC1638_ROTATE_180: return s_Ref[LCD_HEIGHT - 1 - py][LCD_WIDTH - 1 - px];
+        case UC1638_ROTATE_270: return s_Ref[px][LCD_HEIGHT - 1 - py];
+        default:                return s_Ref[py][px];
+    }
+}
+
+static int CheckPanel(int rot, int mirror) {
+    int fails = 0;
+    for (int y = 0; y < LCD_HEIGHT; y++) {
+        for (int x = 0; x < LCD_WIDTH; x++) {
+            if (emu_pixel(x, y) != ExpectedPixel(x, y, rot, mirror)) fails++;
+        }
+    }
+    return fails;
+}
+
+static double FlushTime(UC1638_Rotation_t rot, int loops) {
+    double t0;
+    UC1638_SetRotation(rot);
+    t0 = emu_now_us();
+    for (int i = 0; i < loops; i++) UC1638_Flush();
+    return (emu_now_us() - t0) / loops;
+}
+
+int main(void) {
+    int total = 0;
+
+    UC1638_Init();
+    srand(1);
+    for (int y = 0; y < LCD_HEIGHT; y++) {
+        for (int x = 0; x < LCD_WIDTH; x++) {
+            s_Ref[y][x] = rand() & 1;
+            UC1638_DrawPoint(x, y, s_Ref[y][x] ? COLOR_BLACK : COLOR_WHITE);
+        }
+    }
+
+    for (int rot = 0; rot < 4; rot++) {
+        for (int m = 0; m < 4; m++) {
+            int fails;
+            UC1638_SetRotation((UC1638_Rotation_t)rot);
+            UC1638_SetMirror(m & 1, m >> 1);
+            UC1638_Flush();
+            fails = CheckPanel(rot, m);
+            total += fails;
+            printf("rotate %3d mirror x%d y%d: %s (%d px)\n", rot * 90, m & 1, m >> 1, fails ? "FAIL" : "ok", fails);
+        }
+    }
+    UC1638_SetMirror(0, 0);
+
+    // 切换后只画一个点并局部刷新：方向改变必须让整屏重发
+    for (int rot = 0; rot < 4; rot++) {
+        for (int m = 0; m < 4; m++) {
+            int fails;
+            int x = rand() % LCD_WIDTH, y = rand() % LCD_HEIGHT;
+            UC1638_SetRotation((UC1638_Rotation_t)rot);
+            UC1638_SetMirror(m & 1, m >> 1);
+            s_Ref[y][x] ^= 1;
+            UC1638_DrawPoint(x, y, s_Ref[y][x] ? COLOR_BLACK : COLOR_WHITE);
+            UC1638_FlushDirty();
+            fails = CheckPanel(rot, m);
+            total += fails;
+            printf("switch to %3d mirror x%d y%d + FlushDirty: %s (%d px)\n", rot * 90, m & 1, m >> 1, fails ? "FAIL" : "ok", fails);
+        }
+    }
+    UC1638_SetMirror(0, 0);
+
+    // 0 度与 90 度整帧刷新之差即为 256 个 8x8 块的转置耗时 (SPI 模型开销相同)
+    {
+        const int loops = 2000;
+        double t0 = 1e9, t90 = 1e9;
+        // 交替测量并取最小值，减少主机调度抖动
+        for (int round = 0; round < 5; round++) {
+            double a = FlushTime(UC1638_ROTATE_0, loops);
+            double b = FlushTime(UC1638_ROTATE_90, loops);
+            if (a < t0) t0 = a;
+            if (b < t90) t90 = b;
+        }
+        int blocks = LCD_PAGES * LCD_WIDTH / 8;
+        printf("bench flush: 0 deg %.1f us, 90 deg %.1f us, transpose %.1f ns per 8x8 block\n",
+               t0, t90, (t90 - t0) * 1000.0 / blocks);
+    }
+
+    UC1638_SetRotation(UC1638_ROTATE_0);
+    return total != 0;
+}
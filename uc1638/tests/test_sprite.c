@@ -0,0 +1,229 @@
+/*
+ * test_sprite.c
+ * 精灵层：随机移动/换帧/显隐后，增量 Tick 的结果与在背景上按编号顺序整体重绘一致 (含相互重叠
+ * 的 XOR / SAVE 精灵)，Erase 恢复原背景；帧率控制的追赶、跳帧、长时间停顿与 tick 回绕
+ */
+
+#include "uc1638.h"
+#include "uc1638_sprite.h"
+#include "emu.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define SHEET_BYTES (UC1638_SPRITE_MAX_W * 3 * UC1638_SPRITE_MAX_PAGES)
+
+typedef struct {
+    int id;
+    int mode;
+    int x, y;
+    int frame;
+    int visible;
+} Model_t;
+
+static UC1638_SpriteSheet_t s_Sheet[UC1638_SPRITE_MAX];
+static uint8_t s_SheetData[UC1638_SPRITE_MAX][SHEET_BYTES];
+static Model_t s_Model[UC1638_SPRITE_MAX];
+static uint8_t s_Bg[LCD_PAGES * LCD_WIDTH];
+static uint8_t s_Ref[LCD_PAGES * LCD_WIDTH];
+
+static int SheetPixel(const UC1638_SpriteSheet_t *sh, int frame, int u, int v) {
+    return (sh->data[(v >> 3) * sh->frame_w * sh->frames + frame * sh->frame_w + u] >> (v & 7)) & 1;
+}
+
+// 在背景上按精灵编号 (即绘制) 顺序逐个叠加：XOR 翻转，SAVE 只叠加黑点
+static void Reference(void) {
+    memcpy(s_Ref, s_Bg, sizeof(s_Ref));
+    for (int i = 0; i < UC1638_SPRITE_MAX; i++) {
+        const UC1638_SpriteSheet_t *sh;
+        const Model_t *m = NULL;
+
+        for (int k = 0; k < UC1638_SPRITE_MAX; k++) {
+            if (s_Model[k].id == i) m = &s_Model[k];
+        }
+        if (!m || !m->visible) continue;
+        sh = &s_Sheet[m - s_Model];
+
+        for (int v = 0; v < sh->pages * 8; v++) {
+            for (int u = 0; u < sh->frame_w; u++) {
+                int px = m->x + u, py = m->y + v;
+                uint8_t *d;
+
+                if (px < 0 || px >= LCD_WIDTH || py < 0 || py >= LCD_HEIGHT) continue;
+                if (!SheetPixel(sh, m->frame, u, v)) continue;
+                d = &s_Ref[(py >> 3) * LCD_WIDTH + px];
+                if (m->mode == UC1638_SPRITE_XOR) {
+                    *d ^= (uint8_t)(1 << (py & 7));
+                } else {
+                    *d |= (uint8_t)(1 << (py & 7));
+                }
+            }
+        }
+    }
+}
+
+static void RandomSheet(int k) {
+    UC1638_SpriteSheet_t *sh = &s_Sheet[k];
+
+    sh->frame_w = (uint8_t)(1 + rand() % UC1638_SPRITE_MAX_W);
+    sh->pages = (uint8_t)(1 + rand() % UC1638_SPRITE_MAX_PAGES);
+    sh->frames = (uint8_t)(1 + rand() % 3);
+    for (int i = 0; i < SHEET_BYTES; i++) s_SheetData[k][i] = (uint8_t)rand();
+    sh->data = s_SheetData[k];
+}
+
+// 随机场景：多个相互重叠的精灵反复移动、换帧、显隐，偶尔修改背景或销毁重建
+static int CheckScene(void) {
+    long ticks = 0, mismatches = 0, restore = 0;
+
+    for (int scene = 0; scene < 200; scene++) {
+        int n = 2 + rand() % (UC1638_SPRITE_MAX - 1);
+
+        for (int i = 0; i < (int)sizeof(s_Bg); i++) s_Bg[i] = (uint8_t)rand();
+        memcpy(UC1638_GetBuffer(), s_Bg, sizeof(s_Bg));
+        UC1638_Sprite_Init();
+        memset(s_Model, 0, sizeof(s_Model));
+        for (int k = 0; k < UC1638_SPRITE_MAX; k++) s_Model[k].id = UC1638_SPRITE_NONE;
+
+        // 集中在屏幕一角，保证大量重叠，并覆盖越界位置
+        for (int k = 0; k < n; k++) {
+            Model_t *m = &s_Model[k];
+            RandomSheet(k);
+            m->mode = rand() & 1;
+            m->x = rand() % 60 - 15;
+            m->y = rand() % 60 - 15;
+            m->visible = 1;
+            m->id = UC1638_Sprite_Create(&s_Sheet[k], (UC1638_SpriteMode_t)m->mode, m->x, m->y);
+        }
+
+        for (int step = 0; step < 40; step++) {
+            int k = rand() % n;
+            Model_t *m = &s_Model[k];
+
+            switch (rand() % 6) {
+                case 0:
+                case 1:
+                    m->x += rand() % 11 - 5;
+                    m->y += rand() % 11 - 5;
+                    UC1638_Sprite_MoveTo(m->id, m->x, m->y);
+                    break;
+                case 2:
+                    m->frame = rand() % s_Sheet[k].frames;
+                    UC1638_Sprite_SetFrame(m->id, (uint8_t)m->frame);
+                    break;
+                case 3:
+                    m->visible = !m->visible;
+                    UC1638_Sprite_SetVisible(m->id, (uint8_t)m->visible);
+                    break;
+                case 4:
+                    // 修改背景：先擦除全部精灵
+                    UC1638_Sprite_Erase();
+                    if (memcmp(UC1638_GetBuffer(), s_Bg, sizeof(s_Bg)) != 0) restore++;
+                    UC1638_Fill(rand() % 100, rand() % 100, rand() % 128, rand() % 128, (LCD_Color_t)(rand() & 1));
+                    memcpy(s_Bg, UC1638_GetBuffer(), sizeof(s_Bg));
+                    break;
+                default:
+                    // 销毁后原编号空出，重建时占用最小的空闲编号
+                    UC1638_Sprite_Destroy(m->id);
+                    m->id = UC1638_Sprite_Create(&s_Sheet[k], (UC1638_SpriteMode_t)m->mode, m->x, m->y);
+                    m->frame = 0;
+                    m->visible = 1;
+                    break;
+            }
+
+            UC1638_Sprite_Tick(1, NULL);
+            ticks++;
+            Reference();
+            if (memcmp(UC1638_GetBuffer(), s_Ref, sizeof(s_Ref)) != 0) mismatches++;
+        }
+
+        UC1638_Sprite_Erase();
+        if (memcmp(UC1638_GetBuffer(), s_Bg, sizeof(s_Bg)) != 0) restore++;
+    }
+
+    printf("incremental tick vs full redraw: %s (%ld of %ld ticks differ)\n", mismatches ? "FAIL" : "ok", mismatches, ticks);
+    printf("erase restores background:       %s (%ld)\n", restore ? "FAIL" : "ok", restore);
+    return (int)(mismatches + restore);
+}
+
+// 未使用的编号：设置函数不应改变任何状态，Tick 不绘制
+static int CheckUnused(void) {
+    int id;
+
+    memset(UC1638_GetBuffer(), 0, LCD_PAGES * LCD_WIDTH);
+    memset(s_Bg, 0, sizeof(s_Bg));
+    UC1638_Sprite_Init();
+    RandomSheet(0);
+    id = UC1638_Sprite_Create(&s_Sheet[0], UC1638_SPRITE_SAVE, 10, 10);
+    UC1638_Sprite_Tick(1, NULL);
+    UC1638_Sprite_Destroy(id);
+    UC1638_Sprite_Tick(1, NULL);
+
+    UC1638_Sprite_MoveTo(id, 20, 20);
+    UC1638_Sprite_SetVelocity(id, 1, 1);
+    UC1638_Sprite_SetAnim(id, 1);
+    UC1638_Sprite_SetVisible(id, 1);
+    UC1638_Sprite_SetFrame(id, 1);
+    UC1638_Sprite_Tick(5, NULL);
+
+    if (memcmp(UC1638_GetBuffer(), s_Bg, sizeof(s_Bg)) != 0) {
+        printf("setters on a destroyed sprite: FAIL\n");
+        return 1;
+    }
+    printf("setters on a destroyed sprite:   ok\n");
+    return 0;
+}
+
+// 帧率控制：period = 20 ms
+static int CheckPacer(void) {
+    UC1638_Pacer_t p;
+    int fails = 0;
+    uint16_t s;
+
+    emu_tick = 1000;
+    UC1638_Pacer_Init(&p, 50);
+
+    emu_tick += 19;
+    if (UC1638_Pacer_Poll(&p) != 0) fails++;
+    emu_tick += 1;
+    if (UC1638_Pacer_Poll(&p) != 1 || p.next != 1040) fails++;
+
+    // 落后 3 个周期：推进 4 步，保持原节拍
+    emu_tick = 1040 + 3 * 20 + 7;
+    if (UC1638_Pacer_Poll(&p) != 4 || p.next != 1120 || p.skipped != 3) fails++;
+
+    // 落后过多：只推进 PACER_MAX_CATCHUP 步，从当前时刻重新计时
+    emu_tick = 1120 + 100 * 20;
+    s = UC1638_Pacer_Poll(&p);
+    if (s != 8 || p.next != emu_tick + 20) fails++;
+
+    // 长时间停顿 (late / period 超过 16 位)
+    emu_tick = p.next + 65535u * 20;
+    s = UC1638_Pacer_Poll(&p);
+    if (s != 8 || p.next != emu_tick + 20) fails++;
+    printf("pacer stall of 65535 periods:    %s (%u steps)\n", s == 8 ? "ok" : "FAIL", s);
+
+    // tick 回绕
+    emu_tick = 0xFFFFFFF0u;
+    UC1638_Pacer_Init(&p, 50);
+    emu_tick += 19;
+    if (UC1638_Pacer_Poll(&p) != 0) fails++;
+    emu_tick += 1 + 20;
+    if (UC1638_Pacer_Poll(&p) != 2 || p.next != 0xFFFFFFF0u + 60) fails++;
+
+    printf("pacer catch-up / skip / wrap:    %s (frames %u, skipped %u)\n", fails ? "FAIL" : "ok",
+           (unsigned)p.frames, (unsigned)p.skipped);
+    return fails;
+}
+
+int main(void) {
+    int fails;
+
+    UC1638_Init();
+    srand(34);
+    fails = CheckScene();
+    fails += CheckUnused();
+    fails += CheckPacer();
+    return fails != 0;
+}
@@ -0,0 +1,114 @@
+/*
+ * test_ui.c
+ * 控件层：复用同一文字缓冲 (snprintf 后 SetText) 时标签必须重绘，且结果与直接绘制一致；
+ * BAR 控件的增量更新与整体重绘结果一致，1 像素变化只发送几个字节
+ */
+
+#include "uc1638.h"
+#include "uc1638_ui.h"
+#include "emu.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static uint8_t s_Expect[LCD_PAGES * LCD_WIDTH];
+
+// 一组控件：容器内两个电平条 (一个反色)，另一个电平条被标签部分遮挡
+static void BuildBars(int *ids, const int *values) {
+    int box;
+
+    UC1638_UI_Init();
+    box = UC1638_UI_Container(UC1638_UI_ROOT, 4, 40, 120, 60, 1);
+    ids[0] = UC1638_UI_Bar(box, 4, 4, 100, 10, 1000, values[0]);
+    ids[1] = UC1638_UI_Bar(box, 4, 20, 80, 12, 50, values[1]);
+    ids[2] = UC1638_UI_Bar(box, 4, 40, 110, 9, 300, values[2]);
+    UC1638_UI_SetInverse(ids[1], 1);
+    UC1638_UI_Label(box, 60, 38, "OVER");
+}
+
+// 随机改变数值并逐次渲染，最终结果与按最终数值整体渲染一致
+static int CheckBars(void) {
+    static uint8_t incremental[LCD_PAGES * LCD_WIDTH];
+    static const int max[3] = { 1000, 50, 300 };
+    int ids[3], values[3] = { 500, 20, 100 };
+    int fails = 0;
+
+    UC1638_Clear(COLOR_WHITE);
+    BuildBars(ids, values);
+    UC1638_UI_Render();
+    for (int step = 0; step < 2000; step++) {
+        int k = rand() % 3;
+        values[k] += rand() % 41 - 20;
+        if (values[k] < -10) values[k] = -10;
+        if (values[k] > max[k] + 10) values[k] = max[k] + 10;
+        UC1638_UI_SetValue(ids[k], values[k]);
+        if (rand() % 4 == 0) UC1638_UI_Render();
+
+        if (step % 50 == 49) {
+            UC1638_UI_Render();
+            memcpy(incremental, UC1638_GetBuffer(), sizeof(incremental));
+            UC1638_Clear(COLOR_WHITE);
+            BuildBars(ids, values);
+            UC1638_UI_Render();
+            if (memcmp(incremental, UC1638_GetBuffer(), sizeof(incremental)) != 0) fails++;
+        }
+    }
+    printf("bar incremental vs full render: %s (%d mismatches)\n", fails ? "FAIL" : "ok", fails);
+    return fails;
+}
+
+// 1 像素变化后局部刷新的 SPI 字节数
+static int CheckBarCost(void) {
+    int ids[3], values[3] = { 500, 20, 100 };
+    long bytes;
+    int rects;
+
+    UC1638_Clear(COLOR_WHITE);
+    BuildBars(ids, values);
+    UC1638_UI_Render();
+    UC1638_FlushDirty();
+
+    bytes = emu_bytes;
+    UC1638_UI_SetValue(ids[0], 511); // 填充区 96 像素、满量程 1000：第 48 列 -> 第 49 列
+    rects = UC1638_UI_Render();
+    UC1638_FlushDirty();
+    bytes = emu_bytes - bytes;
+    printf("bar 1 px step: %d update, %ld SPI bytes\n", rects, bytes);
+    return bytes > 32;
+}
+
+int main(void) {
+    static char buf[16];
+    int fails = 0;
+    int id, rects;
+
+    UC1638_Init();
+    UC1638_UI_Init();
+    UC1638_Clear(COLOR_WHITE);
+
+    snprintf(buf, sizeof(buf), "T=%d", 12345);
+    id = UC1638_UI_Label(UC1638_UI_ROOT, 10, 20, buf);
+    UC1638_UI_Render();
+
+    // 同一缓冲改为更短的内容：旧文字的尾部也要擦掉
+    snprintf(buf, sizeof(buf), "T=%d", 7);
+    UC1638_UI_SetText(id, buf);
+    rects = UC1638_UI_Render();
+
+    memcpy(s_Expect, UC1638_GetBuffer(), sizeof(s_Expect));
+    UC1638_Clear(COLOR_WHITE);
+    UC1638_ShowString(10, 20, "T=7", COLOR_BLACK);
+    if (rects == 0 || memcmp(s_Expect, UC1638_GetBuffer(), sizeof(s_Expect)) != 0) fails++;
+    printf("reused text buffer: %s (%d rects)\n", fails ? "FAIL" : "ok", rects);
+
+    // 不同指针、相同内容：不产生损坏
+    UC1638_UI_SetText(id, "T=7");
+    rects = UC1638_UI_Render();
+    if (rects != 0) fails++;
+    printf("same content, new pointer: %s (%d rects)\n", rects ? "FAIL" : "ok", rects);
+
+    fails += CheckBars();
+    fails += CheckBarCost();
+    return fails != 0;
+}
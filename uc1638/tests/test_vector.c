@@ -0,0 +1,260 @@
+/*
+ * test_vector.c
+ * 矢量图元与理想几何比对 (粗线、圆弧、贝塞尔)，并与逐点 UC1638_DrawPoint 构造的等价图形比较耗时
+ * 参考几何使用浮点，仅在主机端测试中使用
+ */
+
+#include "uc1638.h"
+#include "uc1638_vector.h"
+#include "emu.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define TOL         0.35    // 像素中心到理想边界的容差
+#define BENCH_LOOPS 3000
+
+static int GetPixel(int x, int y) {
+    return (UC1638_GetBuffer()[(y >> 3) * LCD_WIDTH + x] >> (y & 7)) & 1;
+}
+
+// 点到线段距离
+static double SegDist(double x, double y, double ax, double ay, double bx, double by) {
+    double dx = bx - ax, dy = by - ay;
+    double l = dx * dx + dy * dy;
+    double t = l ? ((x - ax) * dx + (y - ay) * dy) / l : 0;
+    if (t < 0) t = 0;
+    if (t > 1) t = 1;
+    return hypot(ax + t * dx - x, ay + t * dy - y);
+}
+
+/* ================= 逐点版本 (基准对照) ================= */
+
+// Bresenham 路径上逐点盖圆形笔刷
+static void PointThickLine(int x1, int y1, int x2, int y2, int w) {
+    int dx = abs(x2 - x1), dy = abs(y2 - y1);
+    int sx = x1 < x2 ? 1 : -1, sy = y1 < y2 ? 1 : -1;
+    int err = dx - dy, r = w / 2, r2 = w * w / 4;
+
+    while (1) {
+        for (int j = -r; j <= r; j++) {
+            for (int i = -r; i <= r; i++) {
+                if (i * i + j * j <= r2) UC1638_DrawPoint(x1 + i, y1 + j, COLOR_BLACK);
+            }
+        }
+        if (x1 == x2 && y1 == y2) break;
+        int e2 = 2 * err;
+        if (e2 > -dy) { err -= dy; x1 += sx; }
+        if (e2 < dx) { err += dx; y1 += sy; }
+    }
+}
+
+// 每 1/4 度沿半径逐点
+static void PointArc(int cx, int cy, int r, int a0, int a1, int w) {
+    for (int a = a0 * 4; a <= a1 * 4; a++) {
+        for (int t = -(w / 2); t <= (w - 1) / 2; t++) {
+            int x, y;
+            UC1638_Polar(cx, cy, r + t, (a + 2) / 4, &x, &y);
+            UC1638_DrawPoint(x, y, COLOR_BLACK);
+        }
+    }
+}
+
+// 整数参数步进采样三次贝塞尔，brush = 1 时每点盖十字笔刷
+static void PointCubic(const int *p, int brush) {
+    const long n = 400, n3 = n * n * n;
+    for (long k = 0; k <= n; k++) {
+        long s = k, u = n - k;
+        long x = (u * u * u * p[0] + 3 * u * u * s * p[2] + 3 * u * s * s * p[4] + s * s * s * p[6]) / n3;
+        long y = (u * u * u * p[1] + 3 * u * u * s * p[3] + 3 * u * s * s * p[5] + s * s * s * p[7]) / n3;
+        UC1638_DrawPoint(x, y, COLOR_BLACK);
+        if (brush) {
+            UC1638_DrawPoint(x - 1, y, COLOR_BLACK);
+            UC1638_DrawPoint(x + 1, y, COLOR_BLACK);
+            UC1638_DrawPoint(x, y - 1, COLOR_BLACK);
+            UC1638_DrawPoint(x, y + 1, COLOR_BLACK);
+        }
+    }
+}
+
+/* ================= 精度 ================= */
+
+static int CheckThickLines(void) {
+    long extra = 0, miss = 0;
+
+    for (int t = 0; t < 2000; t++) {
+        int x1 = rand() % 128, y1 = rand() % 128, x2 = rand() % 128, y2 = rand() % 128, w = 2 + rand() % 7;
+        UC1638_Clear(COLOR_WHITE);
+        UC1638_DrawThickLine(x1, y1, x2, y2, w, COLOR_BLACK);
+        for (int y = 0; y < LCD_HEIGHT; y++) {
+            for (int x = 0; x < LCD_WIDTH; x++) {
+                double d = SegDist(x, y, x1, y1, x2, y2);
+                int p = GetPixel(x, y);
+                if (p && d > w / 2.0 + TOL) extra++;
+                if (!p && d < w / 2.0 - TOL) miss++;
+            }
+        }
+    }
+    printf("thick line: %ld px outside r+%.2f, %ld missing inside r-%.2f\n", extra, TOL, miss, TOL);
+    return (int)(extra + miss);
+}
+
+static int CheckArcs(void) {
+    long extra = 0, miss = 0;
+
+    for (int t = 0; t < 1000; t++) {
+        int cx = rand() % 128, cy = rand() % 128, r = 5 + rand() % 70;
+        int a0 = rand() % 360, sweep = 1 + rand() % 360, w = 1 + rand() % 6;
+        double hw = (w > 1) ? w / 2.0 : 0.5;
+
+        UC1638_Clear(COLOR_WHITE);
+        UC1638_DrawArc(cx, cy, r, a0, a0 + sweep, w, COLOR_BLACK);
+        for (int y = 0; y < LCD_HEIGHT; y++) {
+            for (int x = 0; x < LCD_WIDTH; x++) {
+                int p = GetPixel(x, y);
+                double d = fabs(hypot(x - cx, y - cy) - r);
+                double ang = fmod(atan2(y - cy, x - cx) * 180 / M_PI - a0 + 720, 360);
+                // 细线为 Bresenham 折线，允许 1 像素
+                if (p && d > hw + (w > 1 ? TOL : 1.0)) extra++;
+                if (!p && w > 1 && d <= hw - TOL && ang >= 1 && ang <= sweep - 1) miss++;
+            }
+        }
+    }
+    printf("arc: %ld px off the ring, %ld missing inside\n", extra, miss);
+    return (int)(extra + miss);
+}
+
+static int CheckBeziers(void) {
+    static double cx[1001], cy[1001];
+    long far = 0, uncovered = 0, drawn = 0;
+
+    for (int t = 0; t < 500; t++) {
+        int p[8], w = 1 + rand() % 4, cubic = rand() & 1;
+        for (int i = 0; i < 8; i++) p[i] = rand() % 128;
+
+        UC1638_Clear(COLOR_WHITE);
+        if (cubic) {
+            UC1638_DrawBezier3(p[0], p[1], p[2], p[3], p[4], p[5], p[6], p[7], w, COLOR_BLACK);
+        } else {
+            UC1638_DrawBezier2(p[0], p[1], p[2], p[3], p[4], p[5], w, COLOR_BLACK);
+        }
+        for (int i = 0; i <= 1000; i++) {
+            double s = i / 1000.0, u = 1 - s;
+            if (cubic) {
+                cx[i] = u * u * u * p[0] + 3 * u * u * s * p[2] + 3 * u * s * s * p[4] + s * s * s * p[6];
+                cy[i] = u * u * u * p[1] + 3 * u * u * s * p[3] + 3 * u * s * s * p[5] + s * s * s * p[7];
+            } else {
+                cx[i] = u * u * p[0] + 2 * u * s * p[2] + s * s * p[4];
+                cy[i] = u * u * p[1] + 2 * u * s * p[3] + s * s * p[5];
+            }
+        }
+
+        // 画出的像素离曲线不超过 1 像素 (+ 半线宽)
+        for (int y = 0; y < LCD_HEIGHT; y++) {
+            for (int x = 0; x < LCD_WIDTH; x++) {
+                double m = 1e9;
+                if (!GetPixel(x, y)) continue;
+                drawn++;
+                for (int i = 0; i <= 1000; i += 2) {
+                    double d = hypot(cx[i] - x, cy[i] - y);
+                    if (d < m) m = d;
+                }
+                if (m > (w > 1 ? w / 2.0 : 0) + 1.0) far++;
+            }
+        }
+        // 曲线上的采样点附近 (3x3) 必有像素
+        for (int i = 0; i <= 1000; i += 10) {
+            int x = (int)floor(cx[i] + 0.5), y = (int)floor(cy[i] + 0.5), ok = 0;
+            for (int j = -1; j <= 1; j++) {
+                for (int k = -1; k <= 1; k++) {
+                    int X = x + k, Y = y + j;
+                    if (X >= 0 && X < LCD_WIDTH && Y >= 0 && Y < LCD_HEIGHT && GetPixel(X, Y)) ok = 1;
+                }
+            }
+            if (!ok) uncovered++;
+        }
+    }
+    // 细分误差偶有超出 1 像素的孤立点，按比例判定
+    printf("bezier: %ld of %ld px farther than 1 px from the curve, %ld samples uncovered\n", far, drawn, uncovered);
+    return (far * 10000 > drawn) + (int)uncovered;
+}
+
+static int CheckOrigin(void) {
+    static uint8_t a[LCD_PAGES * LCD_WIDTH];
+    int same;
+
+    UC1638_Clear(COLOR_WHITE);
+    UC1638_DrawArc(64, 64, 40, 0, 360, 3, COLOR_BLACK);
+    memcpy(a, UC1638_GetBuffer(), sizeof(a));
+    UC1638_Clear(COLOR_WHITE);
+    UC1638_Translate(10, 5);
+    UC1638_DrawArc(54, 59, 40, 0, 360, 3, COLOR_BLACK);
+    UC1638_ResetClip();
+    same = memcmp(a, UC1638_GetBuffer(), sizeof(a)) == 0;
+    printf("translated arc identical: %s\n", same ? "ok" : "FAIL");
+    return !same;
+}
+
+/* ================= 基准 ================= */
+
+static void Report(const char *name, double vec, double pts) {
+    printf("bench %-22s vector %7.2f us, DrawPoint %7.2f us (x%.1f)\n", name, vec, pts, pts / vec);
+}
+
+static void Bench(void) {
+    static const int cubic[8] = { 5, 120, 30, 0, 90, 127, 122, 10 };
+    double t0, vec, pts;
+
+    srand(7);
+    t0 = emu_now_us();
+    for (int i = 0; i < BENCH_LOOPS; i++) {
+        int a = rand() % 128, b = rand() % 128, c = rand() % 128, d = rand() % 128;
+        UC1638_DrawThickLine(a, b, c, d, 5, COLOR_BLACK);
+    }
+    vec = (emu_now_us() - t0) / BENCH_LOOPS;
+    srand(7);
+    t0 = emu_now_us();
+    for (int i = 0; i < BENCH_LOOPS; i++) {
+        int a = rand() % 128, b = rand() % 128, c = rand() % 128, d = rand() % 128;
+        PointThickLine(a, b, c, d, 5);
+    }
+    pts = (emu_now_us() - t0) / BENCH_LOOPS;
+    Report("thick line w5", vec, pts);
+
+    for (int w = 4; w >= 1; w -= 3) {
+        t0 = emu_now_us();
+        for (int i = 0; i < BENCH_LOOPS; i++) UC1638_DrawArc(64, 64, 50, 135, 405, w, COLOR_BLACK);
+        vec = (emu_now_us() - t0) / BENCH_LOOPS;
+        t0 = emu_now_us();
+        for (int i = 0; i < BENCH_LOOPS; i++) PointArc(64, 64, 50, 135, 405, w);
+        pts = (emu_now_us() - t0) / BENCH_LOOPS;
+        Report(w > 1 ? "arc r50 w4 270deg" : "arc r50 w1 270deg", vec, pts);
+    }
+
+    for (int w = 3; w >= 1; w -= 2) {
+        t0 = emu_now_us();
+        for (int i = 0; i < BENCH_LOOPS; i++) {
+            UC1638_DrawBezier3(cubic[0], cubic[1], cubic[2], cubic[3], cubic[4], cubic[5], cubic[6], cubic[7], w, COLOR_BLACK);
+        }
+        vec = (emu_now_us() - t0) / BENCH_LOOPS;
+        t0 = emu_now_us();
+        for (int i = 0; i < BENCH_LOOPS; i++) PointCubic(cubic, w > 1);
+        pts = (emu_now_us() - t0) / BENCH_LOOPS;
+        Report(w > 1 ? "cubic w3" : "cubic w1", vec, pts);
+    }
+}
+
+int main(void) {
+    int fails = 0;
+
+    UC1638_Init();
+    srand(37);
+    fails += CheckThickLines();
+    fails += CheckArcs();
+    fails += CheckBeziers();
+    fails += CheckOrigin();
+    Bench();
+    return fails != 0;
+}
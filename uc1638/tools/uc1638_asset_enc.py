@@ -0,0 +1,170 @@
+#!/usr/bin/env python3
+"""
+uc1638_asset_enc.py
+将 1bpp 图像编码为 uc1638_asset.h 所述的按页 RLE 资源，输出 C 数组
+
+用法:
+    python3 uc1638_asset_enc.py splash.pbm -n splash > splash_asset.h
+    python3 uc1638_asset_enc.py icons.png -n icons --threshold 128 --invert
+
+输入支持 PBM (P1/P4)；安装 Pillow 时也可读取 PNG/BMP 等格式。
+黑色像素 (PBM 中的 1) 对应显存中置位的点。
+"""
+
+import argparse
+import sys
+
+
+def read_pbm(path):
+    with open(path, "rb") as f:
+        data = f.read()
+
+    tokens = []
+    pos = 0
+
+    # 解析头部: magic, width, height (跳过注释)
+    while len(tokens) < 3:
+        while data[pos:pos + 1].isspace():
+            pos += 1
+        if data[pos:pos + 1] == b"#":
+            while data[pos:pos + 1] not in (b"\n", b""):
+                pos += 1
+            continue
+        start = pos
+        while not data[pos:pos + 1].isspace():
+            pos += 1
+        tokens.append(data[start:pos].decode())
+
+    magic, width, height = tokens[0], int(tokens[1]), int(tokens[2])
+    pixels = []
+
+    if magic == "P4":
+        pos += 1  # 头部后的单个空白
+        stride = (width + 7) // 8
+        for y in range(height):
+            row = data[pos + y * stride:pos + (y + 1) * stride]
+            pixels.append([(row[x // 8] >> (7 - x % 8)) & 1 for x in range(width)])
+    elif magic == "P1":
+        bits = [c - 48 for c in data[pos:] if c in (48, 49)]
+        for y in range(height):
+            pixels.append(bits[y * width:(y + 1) * width])
+    else:
+        raise ValueError("unsupported PBM type: " + magic)
+
+    return width, height, pixels
+
+
+def read_image(path, threshold, invert):
+    if path.lower().endswith(".pbm"):
+        width, height, pixels = read_pbm(path)
+    else:
+        try:
+            from PIL import Image
+        except ImportError:
+            sys.exit("Pillow is required for non-PBM input")
+        img = Image.open(path).convert("L")
+        width, height = img.size
+        px = img.load()
+        # 暗于阈值的像素视为黑色 (置位)
+        pixels = [[1 if px[x, y] < threshold else 0 for x in range(width)] for y in range(height)]
+
+    if invert:
+        pixels = [[1 - p for p in row] for row in pixels]
+    return width, height, pixels
+
+
+def to_pages(width, height, pixels):
+    pages = (height + 7) // 8
+    out = []
+    for p in range(pages):
+        line = bytearray(width)
+        for x in range(width):
+            v = 0
+            for b in range(8):
+                y = p * 8 + b
+                if y < height and pixels[y][x]:
+                    v |= 1 << b
+            line[x] = v
+        out.append(bytes(line))
+    return out
+
+
+def rle_encode(line):
+    out = bytearray()
+    literal = bytearray()
+    i = 0
+
+    def flush_literal():
+        while literal:
+            chunk = literal[:128]
+            out.append(len(chunk) - 1)
+            out.extend(chunk)
+            del literal[:128]
+
+    while i < len(line):
+        run = 1
+        while i + run < len(line) and line[i + run] == line[i] and run < 129:
+            run += 1
+        # 两字节重复夹在原样段中间时不拆分，避免多一个控制字节
+        if run >= 3 or (run == 2 and not literal):
+            flush_literal()
+            out.append(0x80 | (run - 2))
+            out.append(line[i])
+            i += run
+        else:
+            literal.extend(line[i:i + run])
+            i += run
+    flush_literal()
+    return bytes(out)
+
+
+def encode(width, height, pixels):
+    if width > 255:
+        raise ValueError("width must be <= 255")
+    pages = to_pages(width, height, pixels)
+    streams = [rle_encode(p) for p in pages]
+
+    blob = bytearray([width, len(pages)])
+    ofs = 0
+    for s in streams:
+        blob += bytes([ofs & 0xFF, ofs >> 8])
+        ofs += len(s)
+    if ofs > 0xFFFF:
+        raise ValueError("asset too large")
+    for s in streams:
+        blob += s
+    return bytes(blob), width * len(pages)
+
+
+def main():
+    ap = argparse.ArgumentParser(description="Encode a 1bpp image as a UC1638 RLE asset")
+    ap.add_argument("image")
+    ap.add_argument("-n", "--name", default="asset", help="C array name")
+    ap.add_argument("-o", "--output", help="output file (default stdout)")
+    ap.add_argument("--threshold", type=int, default=128, help="grayscale threshold for non-PBM input")
+    ap.add_argument("--invert", action="store_true", help="swap black and white")
+    args = ap.parse_args()
+
+    width, height, pixels = read_image(args.image, args.threshold, args.invert)
+    blob, raw = encode(width, height, pixels)
+
+    lines = [
+        "// %s: %dx%d, %d bytes (raw %d bytes, %.1f%%)" % (
+            args.name, width, height, len(blob), raw, 100.0 * len(blob) / raw),
+        "// generated by tools/uc1638_asset_enc.py",
+        "static const uint8_t %s[%d] = {" % (args.name, len(blob)),
+    ]
+    for i in range(0, len(blob), 16):
+        lines.append("    " + ",".join("0x%02X" % b for b in blob[i:i + 16]) + ",")
+    lines.append("};")
+    text = "\n".join(lines) + "\n"
+
+    if args.output:
+        with open(args.output, "w") as f:
+            f.write(text)
+    else:
+        sys.stdout.write(text)
+
+
+if __name__ == "__main__":
+    main()
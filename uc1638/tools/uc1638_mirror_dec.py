@@ -0,0 +1,190 @@
+#!/usr/bin/env python3
+"""
+uc1638_mirror_dec.py
+解码 uc1638_mirror.c 输出的显存镜像流，还原屏幕并保存为 PBM/PNG
+
+用法:
+    python3 uc1638_mirror_dec.py capture.bin -o screen.png
+    python3 uc1638_mirror_dec.py --port /dev/ttyUSB0 --baud 921600 -o screen.pbm
+    python3 uc1638_mirror_dec.py capture.bin --frames out/      # 每个包保存一帧
+    python3 uc1638_mirror_dec.py capture.bin --bench            # 估算各波特率下的吞吐
+
+包格式见 uc1638_mirror.h。读串口需要 pyserial，输出 PNG 需要 Pillow。
+"""
+
+import argparse
+import os
+import sys
+
+WIDTH = 128
+PAGES = 16
+HEIGHT = PAGES * 8
+
+SYNC = b"\xA5\x5A"
+HEAD = 6
+BAUDS = (115200, 921600)
+
+
+def rle_decode(data, pos, n):
+    out = bytearray()
+    while len(out) < n:
+        c = data[pos]
+        pos += 1
+        if c & 0x80:
+            out.extend(bytes([data[pos]]) * ((c & 0x7F) + 2))
+            pos += 1
+        else:
+            out.extend(data[pos:pos + c + 1])
+            pos += c + 1
+    if len(out) != n:
+        raise ValueError("RLE segment overrun")
+    return bytes(out), pos
+
+
+def parse_packets(data):
+    """逐个返回 (类型, 序号, 负载, 包长)；校验失败时丢弃一个字节重新同步"""
+    pos = 0
+    while True:
+        pos = data.find(SYNC, pos)
+        if pos < 0 or pos + HEAD > len(data):
+            return
+        ptype, seq = data[pos + 2], data[pos + 3]
+        plen = data[pos + 4] | (data[pos + 5] << 8)
+        end = pos + HEAD + plen
+        if end >= len(data):
+            return
+        if ptype not in (ord("K"), ord("D")) or sum(data[pos + 2:end]) & 0xFF != data[end]:
+            pos += 1
+            continue
+        yield chr(ptype), seq, data[pos + HEAD:end], end + 1 - pos
+        pos = end + 1
+
+
+class Screen:
+    def __init__(self):
+        self.fb = bytearray(WIDTH * PAGES)
+        self.synced = False
+        self.seq = None
+        self.lost = 0
+
+    def apply(self, ptype, seq, payload):
+        """应用一个包，返回屏幕是否可信"""
+        if self.seq is not None and seq != (self.seq + 1) & 0xFF:
+            self.lost += (seq - self.seq - 1) & 0xFF
+            self.synced = False
+        self.seq = seq
+        if ptype == "K":
+            self.synced = True
+        elif not self.synced:
+            return False
+
+        pos = 0
+        while pos < len(payload):
+            page, x, n = payload[pos], payload[pos + 1], payload[pos + 2]
+            seg, pos = rle_decode(payload, pos + 3, n)
+            if page >= PAGES or x + n > WIDTH:
+                raise ValueError("segment out of range")
+            self.fb[page * WIDTH + x:page * WIDTH + x + n] = seg
+        return True
+
+    def pixel(self, x, y):
+        return (self.fb[(y >> 3) * WIDTH + x] >> (y & 7)) & 1
+
+    def save(self, path):
+        if path.lower().endswith(".png"):
+            try:
+                from PIL import Image
+            except ImportError:
+                sys.exit("Pillow is required for PNG output")
+            img = Image.new("1", (WIDTH, HEIGHT))
+            img.putdata([0 if self.pixel(x, y) else 1 for y in range(HEIGHT) for x in range(WIDTH)])
+            img.save(path)
+            return
+
+        # P4：每行按位打包，1 为黑
+        rows = bytearray()
+        for y in range(HEIGHT):
+            for bx in range(0, WIDTH, 8):
+                v = 0
+                for b in range(8):
+                    v |= self.pixel(bx + b, y) << (7 - b)
+                rows.append(v)
+        with open(path, "wb") as f:
+            f.write(b"P4\n%d %d\n" % (WIDTH, HEIGHT))
+            f.write(rows)
+
+
+def read_serial(port, baud, seconds):
+    try:
+        import serial
+    except ImportError:
+        sys.exit("pyserial is required for --port")
+    import time
+
+    data = bytearray()
+    with serial.Serial(port, baud, timeout=0.1) as s:
+        deadline = time.time() + seconds
+        while time.time() < deadline:
+            data += s.read(4096)
+    return bytes(data)
+
+
+def bench(packets):
+    """按 8N1 (每字节 10 位) 估算线路占用"""
+    total = sum(p[3] for p in packets)
+    keys = [p[3] for p in packets if p[0] == "K"]
+    deltas = [p[3] for p in packets if p[0] == "D"]
+
+    print("packets %d (keyframes %d, deltas %d), %d bytes" % (len(packets), len(keys), len(deltas), total))
+    if keys:
+        print("keyframe avg %.0f bytes" % (sum(keys) / len(keys)))
+    if deltas:
+        print("delta avg %.0f bytes, max %d bytes" % (sum(deltas) / len(deltas), max(deltas)))
+    for baud in BAUDS:
+        bps = baud / 10.0
+        line = "%7d baud: stream %.2f s" % (baud, total / bps)
+        if keys:
+            line += ", keyframe %.1f ms" % (1000.0 * sum(keys) / len(keys) / bps)
+        if deltas:
+            avg = sum(deltas) / len(deltas)
+            line += ", delta %.1f ms (max %.0f updates/s)" % (1000.0 * avg / bps, bps / avg)
+        print(line)
+
+
+def main():
+    ap = argparse.ArgumentParser(description="Decode a UC1638 framebuffer mirror stream")
+    ap.add_argument("capture", nargs="?", help="raw capture file (omit with --port)")
+    ap.add_argument("--port", help="read from a serial port instead of a file")
+    ap.add_argument("--baud", type=int, default=921600)
+    ap.add_argument("--seconds", type=float, default=5.0, help="serial capture time")
+    ap.add_argument("-o", "--output", help="write the final frame (.pbm or .png)")
+    ap.add_argument("--frames", help="directory to write every decoded frame as PBM")
+    ap.add_argument("--bench", action="store_true", help="report packet sizes and link time per baud rate")
+    args = ap.parse_args()
+
+    if args.port:
+        data = read_serial(args.port, args.baud, args.seconds)
+    elif args.capture:
+        with open(args.capture, "rb") as f:
+            data = f.read()
+    else:
+        ap.error("need a capture file or --port")
+
+    packets = list(parse_packets(data))
+    screen = Screen()
+    if args.frames:
+        os.makedirs(args.frames, exist_ok=True)
+    for i, (ptype, seq, payload, _) in enumerate(packets):
+        if screen.apply(ptype, seq, payload) and args.frames:
+            screen.save(os.path.join(args.frames, "frame_%05d.pbm" % i))
+
+    print("decoded %d packets, %d lost, %s" % (
+        len(packets), screen.lost, "in sync" if screen.synced else "waiting for keyframe"), file=sys.stderr)
+    if args.bench:
+        bench(packets)
+    if args.output:
+        screen.save(args.output)
+
+
+if __name__ == "__main__":
+    main()
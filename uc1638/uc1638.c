@@ -6,15 +6,62 @@
 
 #include "uc1638.h"
 #include "uc1638_font.h"
+#include "uc1638_seq.h"
 #include <string.h> // memset
 #include <stdlib.h> // abs
 
 // 显存缓冲区：128列 * 16页 = 2048 Bytes
 static uint8_t s_DisplayBuf[LCD_PAGES * LCD_WIDTH];
 
+// 脏区：每页记录被修改过的列范围 (逻辑坐标)，min > max 表示该页干净
+static uint8_t s_DirtyMin[LCD_PAGES];
+static uint8_t s_DirtyMax[LCD_PAGES];
+
+// LCD Map Control (0xC0 | LC): bit1 = MX 列镜像, bit2 = MY 行镜像
+#define UC1638_MAP_MX       0x02
+#define UC1638_MAP_MY       0x04
+#define UC1638_MAP_DEFAULT  UC1638_MAP_MY // 原初始化序列中的 0xC4 即为正常方向
+
+#if LCD_WIDTH != LCD_HEIGHT
+#error "90/270 度转置刷新要求屏幕为正方形"
+#endif
+
+// 方向状态
+static UC1638_Rotation_t s_Rotation = UC1638_ROTATE_0;
+static uint8_t s_MirrorBits = 0;                // 用户镜像 (MX/MY)
+static uint8_t s_ColOffset = LCD_COL_OFFSET;    // 当前生效的列偏移
+static uint8_t s_LineBuf[LCD_WIDTH];            // 90/270 度转置后的一页数据
+
+// 面板参数 (对比度 / 偏压)，初始化与唤醒时代入命令序列
+static uint8_t s_Contrast = LCD_CONTRAST;
+static uint8_t s_Sleeping = 0;
+
+// 整帧 DMA 传输进行中 (片选保持低电平)
+static volatile uint8_t s_DmaBusy = 0;
+
+// 图形上下文：裁剪矩形 (含边界，屏幕坐标) 与原点平移，所有绘图只落在裁剪区内
+#define UC1638_GC_DEPTH     8
+
+typedef struct {
+    UC1638_Rect_t clip;
+    int16_t ox, oy;
+} UC1638_GC_t;
+
+static UC1638_Rect_t s_Clip = { 0, 0, LCD_WIDTH - 1, LCD_HEIGHT - 1 };
+static int16_t s_OriginX = 0;
+static int16_t s_OriginY = 0;
+static UC1638_GC_t s_GcStack[UC1638_GC_DEPTH];
+static uint8_t s_GcDepth = 0;
+static uint8_t s_GcOverflow = 0;
+
 /* ================= 底层 SPI 通信 ================= */
 
-static void UC1638_Write(uint8_t data, uint8_t is_cmd) {
+// 一次片选内连续发送多个同类字节
+static void UC1638_WriteBuf(const uint8_t *buf, uint16_t len, uint8_t is_cmd) {
+    while (s_DmaBusy) {
+        // 等待整帧 DMA 结束
+    }
+
     if (is_cmd) {
         UC1638_CMD_MODE();
     } else {
@@ -22,14 +69,199 @@ static void UC1638_Write(uint8_t data, uint8_t is_cmd) {
     }
 
     UC1638_CS_LOW();
-    HAL_SPI_Transmit(UC1638_SPI_HANDLE, &data, 1, 10);
+    HAL_SPI_Transmit(UC1638_SPI_HANDLE, (uint8_t *)buf, len, 100);
     UC1638_CS_HIGH();
 }
 
+static void UC1638_Write(uint8_t data, uint8_t is_cmd) {
+    UC1638_WriteBuf(&data, 1, is_cmd);
+}
+
 // 便捷宏
 #define WRITE_CMD(c)  UC1638_Write(c, 1)
 #define WRITE_DATA(d) UC1638_Write(d, 0)
 
+// 当前方向相对默认方向需要翻转的 MX/MY 位
+// 90/270 度 = 转置 + 单轴镜像，180 度 = 双轴镜像
+static uint8_t UC1638_MapBits(void) {
+    uint8_t bits = s_MirrorBits;
+
+    switch (s_Rotation) {
+        case UC1638_ROTATE_90:  bits ^= UC1638_MAP_MX; break;
+        case UC1638_ROTATE_180: bits ^= UC1638_MAP_MX | UC1638_MAP_MY; break;
+        case UC1638_ROTATE_270: bits ^= UC1638_MAP_MY; break;
+        default: break;
+    }
+
+    // MX 翻转 SEG 方向后，面板可见区域对应的 RAM 列窗口随之平移
+    s_ColOffset = (bits & UC1638_MAP_MX) ? LCD_COL_OFFSET_MX : LCD_COL_OFFSET;
+    return bits;
+}
+
+// 按当前面板参数展开并发送命令序列，同电平的连续字节合并为一次传输
+static void UC1638_SendSeq(const uint8_t *seq) {
+    UC1638_Panel_t panel;
+    uint8_t batch[32];
+    uint8_t is_cmd = 1;
+    uint8_t delay_ms;
+
+    panel.map = UC1638_MAP_DEFAULT ^ UC1638_MapBits(); // 同时更新 s_ColOffset
+    panel.col_offset = s_ColOffset;
+    panel.width = LCD_WIDTH;
+    panel.contrast = s_Contrast;
+    panel.bias = LCD_BIAS;
+
+    while (1) {
+        uint16_t n = UC1638_Seq_Next(&seq, &panel, batch, sizeof(batch), &is_cmd, &delay_ms);
+        if (n > 0) {
+            UC1638_WriteBuf(batch, n, is_cmd);
+        } else if (delay_ms > 0) {
+            HAL_Delay(delay_ms);
+        } else {
+            break;
+        }
+    }
+}
+
+/* ================= 方向控制 ================= */
+
+static uint8_t UC1638_IsTransposed(void) {
+    return s_Rotation == UC1638_ROTATE_90 || s_Rotation == UC1638_ROTATE_270;
+}
+
+// 下发 Map Control 与列窗口
+// 转置状态或列窗口变化后，控制器 RAM 中的内容整体失效，登记全屏脏区供 FlushDirty / Resume 重发
+static void UC1638_ApplyMap(uint8_t was_transposed) {
+    uint8_t offset = s_ColOffset;
+    static const uint8_t seq[] = {
+        UC1638_SEQ_PARAM(UC1638_P_MAP),
+        UC1638_SEQ_CMD(1), 0xF4,                // Window Start Col
+        UC1638_SEQ_PARAM(UC1638_P_COL_START),
+        UC1638_SEQ_CMD(1), 0xF6,                // Window End Col
+        UC1638_SEQ_PARAM(UC1638_P_COL_END),
+        UC1638_SEQ_END
+    };
+
+    UC1638_SendSeq(seq);
+
+    if (was_transposed != UC1638_IsTransposed() || offset != s_ColOffset) {
+        UC1638_MarkDirty(0, 0, LCD_WIDTH - 1, LCD_HEIGHT - 1);
+    }
+}
+
+void UC1638_SetRotation(UC1638_Rotation_t rot) {
+    uint8_t was_transposed = UC1638_IsTransposed();
+    s_Rotation = rot;
+    UC1638_ApplyMap(was_transposed);
+}
+
+UC1638_Rotation_t UC1638_GetRotation(void) {
+    return s_Rotation;
+}
+
+void UC1638_SetMirror(uint8_t mirror_x, uint8_t mirror_y) {
+    s_MirrorBits = (mirror_x ? UC1638_MAP_MX : 0) | (mirror_y ? UC1638_MAP_MY : 0);
+    UC1638_ApplyMap(UC1638_IsTransposed());
+}
+
+// 8x8 位矩阵转置：in[i] 的 bit j -> out[j] 的 bit i
+// 以两个 32 位字完成三轮块交换 (1x1 -> 2x2 -> 4x4)，无逐位循环
+static void UC1638_Transpose8x8(const uint8_t *in, uint8_t *out) {
+    uint32_t lo = in[0] | (in[1] << 8) | ((uint32_t)in[2] << 16) | ((uint32_t)in[3] << 24);
+    uint32_t hi = in[4] | (in[5] << 8) | ((uint32_t)in[6] << 16) | ((uint32_t)in[7] << 24);
+    uint32_t t;
+
+    t = (lo ^ (lo >> 7)) & 0x00AA00AA; lo ^= t ^ (t << 7);
+    t = (hi ^ (hi >> 7)) & 0x00AA00AA; hi ^= t ^ (t << 7);
+
+    t = (lo ^ (lo >> 14)) & 0x0000CCCC; lo ^= t ^ (t << 14);
+    t = (hi ^ (hi >> 14)) & 0x0000CCCC; hi ^= t ^ (t << 14);
+
+    t = ((lo >> 4) ^ hi) & 0x0F0F0F0F;
+    hi ^= t;
+    lo ^= t << 4;
+
+    out[0] = (uint8_t)lo; out[1] = (uint8_t)(lo >> 8); out[2] = (uint8_t)(lo >> 16); out[3] = (uint8_t)(lo >> 24);
+    out[4] = (uint8_t)hi; out[5] = (uint8_t)(hi >> 8); out[6] = (uint8_t)(hi >> 16); out[7] = (uint8_t)(hi >> 24);
+}
+
+// 从物理第 page 页第 x 列起直接写控制器 RAM，不经过显存
+void UC1638_WriteRaw(uint8_t page, uint8_t x, const uint8_t *data, uint16_t len) {
+    uint8_t cmd[3];
+
+    // 1. 页地址 (0x60 + LSB, 0x70 + MSB) 与列地址命令合并为一次传输
+    cmd[0] = 0x60 | (page & 0x0F);
+    cmd[1] = 0x70 | (page >> 4);
+    cmd[2] = 0x04;
+    UC1638_WriteBuf(cmd, 3, 1);
+
+    // 2. 列地址 (需加物理 Offset)
+    WRITE_DATA(s_ColOffset + x);
+
+    // 3. 写入数据指令 + 批量发送
+    WRITE_CMD(0x01);
+    UC1638_WriteBuf(data, len, 0);
+}
+
+// 整帧突发写入：窗口程序使地址在页尾自动折返，设一次起始地址即可连续发送全部页
+// 开启 DMA 时立即返回，传输结束由 UC1638_SPI_TxCpltHandler 释放片选
+uint8_t UC1638_FlushFrameDMA(const uint8_t *frame) {
+    static const uint8_t start[] = { 0x60, 0x70, 0x04 }; // 第 0 页, 列地址
+
+    if (s_DmaBusy) return 0;
+
+    UC1638_WriteBuf(start, sizeof(start), 1);
+    WRITE_DATA(s_ColOffset);
+    WRITE_CMD(0x01);
+
+#if UC1638_USE_DMA
+    s_DmaBusy = 1;
+    UC1638_DATA_MODE();
+    UC1638_CS_LOW();
+    if (HAL_SPI_Transmit_DMA(UC1638_SPI_HANDLE, (uint8_t *)frame, LCD_PAGES * LCD_WIDTH) != HAL_OK) {
+        UC1638_CS_HIGH();
+        s_DmaBusy = 0;
+        return 0;
+    }
+#else
+    UC1638_WriteBuf(frame, LCD_PAGES * LCD_WIDTH, 0);
+#endif
+    return 1;
+}
+
+uint8_t UC1638_IsBusy(void) {
+    return s_DmaBusy;
+}
+
+void UC1638_SPI_TxCpltHandler(void) {
+    if (s_DmaBusy) {
+        UC1638_CS_HIGH();
+        s_DmaBusy = 0;
+    }
+}
+
+// 发送物理第 page 页的 [x1, x2] 列
+// 0/180 度直接发送显存；90/270 度时物理页 P 的第 8k~8k+7 列由逻辑第 k 页的 8P~8P+7 列转置得到
+static void UC1638_SendPage(uint8_t page, uint8_t x1, uint8_t x2) {
+    const uint8_t *pBuf;
+
+    if (UC1638_IsTransposed()) {
+        for (uint8_t k = x1 / 8; k <= x2 / 8; k++) {
+            UC1638_Transpose8x8(&s_DisplayBuf[k * LCD_WIDTH + page * 8], &s_LineBuf[k * 8]);
+        }
+        pBuf = s_LineBuf;
+    } else {
+        pBuf = &s_DisplayBuf[page * LCD_WIDTH];
+    }
+
+    UC1638_WriteRaw(page, x1, pBuf + x1, x2 - x1 + 1);
+}
+
+static void UC1638_ClearDirty(void) {
+    memset(s_DirtyMin, 0xFF, sizeof(s_DirtyMin));
+    memset(s_DirtyMax, 0x00, sizeof(s_DirtyMax));
+}
+
 /* ================= 初始化与核心控制 ================= */
 
 void UC1638_Init(void) {
@@ -39,119 +271,332 @@ void UC1638_Init(void) {
     UC1638_RST_HIGH();
     HAL_Delay(50); // 等待芯片启动
 
-    // 2. 初始化序列 (完全复刻 Python 代码)
-    WRITE_CMD(0xE2); HAL_Delay(5); // System Reset
-    
-    // --- 显示控制 ---
-    WRITE_CMD(0xA4); // Set All Pixel ON -> OFF
-    WRITE_CMD(0xA6); // Set Inverse Display -> OFF (正常显示)
-
-    // --- 电源管理 ---
-    WRITE_CMD(0xB8); WRITE_DATA(0x00); // LCD Control (MTP)
-    WRITE_CMD(0x2D); // Power Control: Enable Internal Charge Pump
-    WRITE_CMD(0x20); // Temp Comp
-    WRITE_CMD(0xEA); // Bias Setting
-
-    // --- 对比度设置 ---
-    WRITE_CMD(0x81); WRITE_DATA(170); // 设置 Vbias (对比度 170)
-
-    // --- 扫描控制 ---
-    WRITE_CMD(0xA3); // Set Line Rate
-    WRITE_CMD(0xC8); WRITE_DATA(0x2F); // Set COM Scan Direction
-
-    // --- 地址映射 ---
-    WRITE_CMD(0x89); WRITE_CMD(0x95); // RAM Address Control
-    WRITE_CMD(0x84); // Set COM0
-    WRITE_CMD(0xF1); WRITE_DATA(127); // Set COM End
-    WRITE_CMD(0xC4); // LCD Map Control
-    WRITE_CMD(0x86); // COM Scan Function
-
-    // --- 滚动与窗口 ---
-    WRITE_CMD(0x40); WRITE_CMD(0x50); // Set Scroll Line 0
-    // [关键] 设置列地址物理偏移 55
-    WRITE_CMD(0x04); WRITE_DATA(LCD_COL_OFFSET);
-
-    // 窗口程序 (Window Program)
-    WRITE_CMD(0xF4); WRITE_DATA(55);  // Window Start Col
-    WRITE_CMD(0xF6); WRITE_DATA(182); // Window End Col
-    WRITE_CMD(0xF5); WRITE_DATA(0);   // Window Start Page
-    WRITE_CMD(0xF7); WRITE_DATA(15);  // Window End Page
-    WRITE_CMD(0xF9); // Window Enable
-
-    // 开启显示
-    WRITE_CMD(0xC9); WRITE_DATA(0xAD); // Display Enable
-    
+    // 2. 初始化序列 (见 uc1638_seq.h，与 ESP32 移植共用)
+    UC1638_SendSeq(UC1638_SEQ_INIT);
+    s_Sleeping = 0;
+
     // 清空屏幕
     UC1638_Clear(COLOR_WHITE);
     UC1638_Flush();
 }
 
+void UC1638_SetContrast(uint8_t contrast) {
+    s_Contrast = contrast;
+    WRITE_CMD(0x81);
+    WRITE_DATA(contrast);
+}
+
+void UC1638_Sleep(void) {
+    if (s_Sleeping) return;
+    UC1638_SendSeq(UC1638_SEQ_SLEEP);
+    s_Sleeping = 1;
+}
+
+void UC1638_Resume(void) {
+    if (s_Sleeping) {
+        UC1638_SendSeq(UC1638_SEQ_WAKE);
+        s_Sleeping = 0;
+    }
+    // 控制器 RAM 在省电期间保持，只需补发休眠期间的改动
+    UC1638_FlushDirty();
+}
+
 void UC1638_Clear(LCD_Color_t color) {
     uint8_t val = (color == COLOR_BLACK) ? 0xFF : 0x00;
     memset(s_DisplayBuf, val, sizeof(s_DisplayBuf));
+    UC1638_MarkDirty(0, 0, LCD_WIDTH - 1, LCD_HEIGHT - 1);
 }
 
-void UC1638_Flush(void) {
-    uint8_t *pBuf = s_DisplayBuf;
+uint8_t *UC1638_GetBuffer(void) {
+    return s_DisplayBuf;
+}
 
-    for (uint8_t page = 0; page < LCD_PAGES; page++) {
-        // 1. 设置页地址 (Page Address Set: 0x60 + LSB, 0x70 + MSB)
-        WRITE_CMD(0x60 | (page & 0x0F));
-        WRITE_CMD(0x70 | (page >> 4));
+const uint8_t *UC1638_GetGlyph(char c) {
+    return Get_Font_Pointer(c);
+}
 
-        // 2. 重置列地址 (每次写入后需要加物理 Offset)
-        WRITE_CMD(0x04); 
-        WRITE_DATA(LCD_COL_OFFSET);
+void UC1638_MarkDirty(int x1, int y1, int x2, int y2) {
+    if (x1 < 0) x1 = 0;
+    if (y1 < 0) y1 = 0;
+    if (x2 >= LCD_WIDTH) x2 = LCD_WIDTH - 1;
+    if (y2 >= LCD_HEIGHT) y2 = LCD_HEIGHT - 1;
+    if (x1 > x2 || y1 > y2) return;
 
-        // 3. 写入数据指令
-        WRITE_CMD(0x01);
+    for (int page = y1 / 8; page <= y2 / 8; page++) {
+        if (x1 < s_DirtyMin[page]) s_DirtyMin[page] = x1;
+        if (x2 > s_DirtyMax[page]) s_DirtyMax[page] = x2;
+    }
+}
 
-        // 4. 批量发送一页数据 (128 Bytes)
-        UC1638_DATA_MODE();
-        UC1638_CS_LOW();
-        HAL_SPI_Transmit(UC1638_SPI_HANDLE, pBuf, LCD_WIDTH, 100);
-        UC1638_CS_HIGH();
+// 刷新完成钩子：默认为空，扩展模块 (如 uc1638_mirror) 可重新定义
+// 在刷新路径中调用，实现中只应记录刚发出的范围，耗时工作放到主循环
+__weak void UC1638_FlushCpltCallback(const uint8_t *x_min, const uint8_t *x_max) {
+    (void)x_min;
+    (void)x_max;
+}
 
-        pBuf += LCD_WIDTH; // 移动缓冲区指针
+void UC1638_Flush(void) {
+    for (uint8_t page = 0; page < LCD_PAGES; page++) {
+        UC1638_SendPage(page, 0, LCD_WIDTH - 1);
     }
+    UC1638_MarkDirty(0, 0, LCD_WIDTH - 1, LCD_HEIGHT - 1);
+    UC1638_FlushCpltCallback(s_DirtyMin, s_DirtyMax);
+    UC1638_ClearDirty();
+}
+
+void UC1638_FlushDirty(void) {
+    if (UC1638_IsTransposed()) {
+        // 逻辑第 k 页的 [a, b] 列 -> 物理第 a/8 ~ b/8 页的 8k ~ 8k+7 列
+        uint8_t pmin[LCD_PAGES];
+        uint8_t pmax[LCD_PAGES];
+
+        memset(pmin, 0xFF, sizeof(pmin));
+        memset(pmax, 0x00, sizeof(pmax));
+        for (uint8_t k = 0; k < LCD_PAGES; k++) {
+            if (s_DirtyMin[k] > s_DirtyMax[k]) continue;
+            for (uint8_t p = s_DirtyMin[k] / 8; p <= s_DirtyMax[k] / 8; p++) {
+                if (k * 8 < pmin[p]) pmin[p] = k * 8;
+                if (k * 8 + 7 > pmax[p]) pmax[p] = k * 8 + 7;
+            }
+        }
+        for (uint8_t p = 0; p < LCD_PAGES; p++) {
+            if (pmin[p] <= pmax[p]) UC1638_SendPage(p, pmin[p], pmax[p]);
+        }
+    } else {
+        for (uint8_t page = 0; page < LCD_PAGES; page++) {
+            if (s_DirtyMin[page] <= s_DirtyMax[page]) {
+                UC1638_SendPage(page, s_DirtyMin[page], s_DirtyMax[page]);
+            }
+        }
+    }
+    UC1638_FlushCpltCallback(s_DirtyMin, s_DirtyMax);
+    UC1638_ClearDirty();
 }
 
 /* ================= 绘图算法 (移植自 Python) ================= */
 
-void UC1638_DrawPoint(int x, int y, LCD_Color_t color) {
-    if (x < 0 || x >= LCD_WIDTH || y < 0 || y >= LCD_HEIGHT) return;
+/* ---------- 图形上下文：裁剪栈与原点平移 ---------- */
 
-    int page = y / 8;
-    int bit = y % 8;
-    int idx = page * LCD_WIDTH + x;
+// 当前上下文存于 s_Clip / s_OriginX / s_OriginY，Push 时整体入栈
+void UC1638_SetClip(int x1, int y1, int x2, int y2) {
+    x1 += s_OriginX; x2 += s_OriginX;
+    y1 += s_OriginY; y2 += s_OriginY;
 
-    if (color == COLOR_BLACK) {
-        s_DisplayBuf[idx] |= (1 << bit);
-    } else {
-        s_DisplayBuf[idx] &= ~(1 << bit);
+    if (x1 < 0) x1 = 0;
+    if (y1 < 0) y1 = 0;
+    if (x2 >= LCD_WIDTH) x2 = LCD_WIDTH - 1;
+    if (y2 >= LCD_HEIGHT) y2 = LCD_HEIGHT - 1;
+
+    // x1 > x2 或 y1 > y2 表示空裁剪区，之后的绘图全部丢弃
+    s_Clip.x1 = x1;
+    s_Clip.y1 = y1;
+    s_Clip.x2 = x2;
+    s_Clip.y2 = y2;
+}
+
+void UC1638_ResetClip(void) {
+    s_GcDepth = 0;
+    s_GcOverflow = 0;
+    s_OriginX = 0;
+    s_OriginY = 0;
+    UC1638_SetClip(0, 0, LCD_WIDTH - 1, LCD_HEIGHT - 1);
+}
+
+void UC1638_GetClip(UC1638_Rect_t *rect) {
+    *rect = s_Clip;
+}
+
+// 第 page 页中位于裁剪区内的行掩码 (页超出裁剪区时为 0)
+uint8_t UC1638_GetClipMask(int page) {
+    int r1 = s_Clip.y1 - page * 8;
+    int r2 = s_Clip.y2 - page * 8;
+
+    if (r1 > 7 || r2 < 0 || s_Clip.x1 > s_Clip.x2) return 0;
+    if (r1 < 0) r1 = 0;
+    if (r2 > 7) r2 = 7;
+    return (uint8_t)((0xFF << r1) & (0xFF >> (7 - r2)));
+}
+
+void UC1638_PushClip(int x1, int y1, int x2, int y2) {
+    if (s_GcDepth >= UC1638_GC_DEPTH) {
+        s_GcOverflow++; // 超出深度：本次 Push 不生效，仅保持 Pop 配对
+        return;
     }
+
+    s_GcStack[s_GcDepth].clip = s_Clip;
+    s_GcStack[s_GcDepth].ox = s_OriginX;
+    s_GcStack[s_GcDepth].oy = s_OriginY;
+    s_GcDepth++;
+
+    // 新裁剪区 = 当前裁剪区 ∩ 给定矩形
+    x1 += s_OriginX; x2 += s_OriginX;
+    y1 += s_OriginY; y2 += s_OriginY;
+    if (x1 > s_Clip.x1) s_Clip.x1 = x1;
+    if (y1 > s_Clip.y1) s_Clip.y1 = y1;
+    if (x2 < s_Clip.x2) s_Clip.x2 = x2;
+    if (y2 < s_Clip.y2) s_Clip.y2 = y2;
 }
 
-void UC1638_DrawLine(int x1, int y1, int x2, int y2, LCD_Color_t color) {
+void UC1638_PopClip(void) {
+    if (s_GcOverflow > 0) {
+        s_GcOverflow--;
+        return;
+    }
+    if (s_GcDepth == 0) return;
+
+    s_GcDepth--;
+    s_Clip = s_GcStack[s_GcDepth].clip;
+    s_OriginX = s_GcStack[s_GcDepth].ox;
+    s_OriginY = s_GcStack[s_GcDepth].oy;
+}
+
+void UC1638_Translate(int dx, int dy) {
+    s_OriginX += dx;
+    s_OriginY += dy;
+}
+
+void UC1638_GetOrigin(int *x, int *y) {
+    *x = s_OriginX;
+    *y = s_OriginY;
+}
+
+/* ---------- 基本图元 ---------- */
+// 公开接口先做原点平移，再调用 *Abs 版本 (屏幕绝对坐标)
+// 每个图元入口处一次性裁剪，内层循环用 PLOT 直接写显存，结束时整体登记脏区
+
+// 无检查写像素：调用者保证 (x, y) 位于裁剪区内
+#define PLOT(x, y, color) do { \
+        uint8_t *p_ = &s_DisplayBuf[((y) >> 3) * LCD_WIDTH + (x)]; \
+        if ((color) == COLOR_BLACK) *p_ |= (uint8_t)(1 << ((y) & 7)); \
+        else *p_ &= (uint8_t)~(1 << ((y) & 7)); \
+    } while (0)
+
+#define IN_CLIP(px, py) ((px) >= s_Clip.x1 && (px) <= s_Clip.x2 && (py) >= s_Clip.y1 && (py) <= s_Clip.y2)
+
+// 包围盒与裁剪区的关系 (空裁剪区视为全部在外)
+#define CLIP_EMPTY()                (s_Clip.x1 > s_Clip.x2 || s_Clip.y1 > s_Clip.y2)
+#define BOX_OUTSIDE(l, t, r, b) ((r) < s_Clip.x1 || (l) > s_Clip.x2 || (b) < s_Clip.y1 || (t) > s_Clip.y2 || CLIP_EMPTY())
+#define BOX_INSIDE(l, t, r, b)  ((l) >= s_Clip.x1 && (r) <= s_Clip.x2 && (t) >= s_Clip.y1 && (b) <= s_Clip.y2)
+
+// 登记包围盒与裁剪区的交集为脏区
+static void UC1638_MarkDirtyClipped(int x1, int y1, int x2, int y2) {
+    if (x1 < s_Clip.x1) x1 = s_Clip.x1;
+    if (y1 < s_Clip.y1) y1 = s_Clip.y1;
+    if (x2 > s_Clip.x2) x2 = s_Clip.x2;
+    if (y2 > s_Clip.y2) y2 = s_Clip.y2;
+    UC1638_MarkDirty(x1, y1, x2, y2);
+}
+
+// 区域填充：按页生成字节掩码，整列写入
+static void UC1638_FillAbs(int x1, int y1, int x2, int y2, LCD_Color_t color) {
+    if (x1 < s_Clip.x1) x1 = s_Clip.x1;
+    if (x2 > s_Clip.x2) x2 = s_Clip.x2;
+    if (y1 < s_Clip.y1) y1 = s_Clip.y1;
+    if (y2 > s_Clip.y2) y2 = s_Clip.y2;
+    if (x1 > x2 || y1 > y2) return;
+
+    int page_start = y1 / 8;
+    int page_end = y2 / 8;
+    int row1 = y1 % 8;
+    int row2 = y2 % 8;
+
+    for (int page = page_start; page <= page_end; page++) {
+        int r_s = (page == page_start) ? row1 : 0;
+        int r_e = (page == page_end) ? row2 : 7;
+        uint8_t mask = (uint8_t)((0xFF << r_s) & (0xFF >> (7 - r_e)));
+        uint8_t *p = &s_DisplayBuf[page * LCD_WIDTH];
+
+        if (color == COLOR_BLACK) {
+            for (int col = x1; col <= x2; col++) p[col] |= mask;
+        } else {
+            for (int col = x1; col <= x2; col++) p[col] &= ~mask;
+        }
+    }
+
+    UC1638_MarkDirty(x1, y1, x2, y2);
+}
+
+void UC1638_DrawPoint(int x, int y, LCD_Color_t color) {
+    x += s_OriginX;
+    y += s_OriginY;
+    if (!IN_CLIP(x, y)) return;
+
+    PLOT(x, y, color);
+
+    int page = y >> 3;
+    if (x < s_DirtyMin[page]) s_DirtyMin[page] = x;
+    if (x > s_DirtyMax[page]) s_DirtyMax[page] = x;
+}
+
+static void UC1638_DrawLineAbs(int x1, int y1, int x2, int y2, LCD_Color_t color) {
+    int bx1 = (x1 < x2) ? x1 : x2, bx2 = (x1 < x2) ? x2 : x1;
+    int by1 = (y1 < y2) ? y1 : y2, by2 = (y1 < y2) ? y2 : y1;
+
+    // 整条线在裁剪区外
+    if (BOX_OUTSIDE(bx1, by1, bx2, by2)) return;
+
+    // 水平 / 垂直线按区域填充处理 (字节掩码)
+    if (x1 == x2 || y1 == y2) {
+        UC1638_FillAbs(bx1, by1, bx2, by2, color);
+        return;
+    }
+
     int dx = abs(x2 - x1);
     int dy = abs(y2 - y1);
     int sx = (x1 < x2) ? 1 : -1;
     int sy = (y1 < y2) ? 1 : -1;
     int err = dx - dy;
+    int n = (dx > dy) ? dx : dy; // 剩余步数 (Bresenham 每步主轴必前进一格)
+
+    if (!BOX_INSIDE(bx1, by1, bx2, by2)) {
+        // 部分可见：先只推进误差项跳过裁剪区外的起始段
+        while (!IN_CLIP(x1, y1)) {
+            if (n-- == 0) return;
+            int e2 = 2 * err;
+            if (e2 > -dy) { err -= dy; x1 += sx; }
+            if (e2 < dx)  { err += dx; y1 += sy; }
+        }
 
-    while (1) {
-        UC1638_DrawPoint(x1, y1, color);
-        if (x1 == x2 && y1 == y2) break;
-        int e2 = 2 * err;
-        if (e2 > -dy) {
-            err -= dy;
-            x1 += sx;
+        // 直线单调，可见部分是连续的一段：按两轴到裁剪边界的距离截短步数
+        int lim_x = (sx > 0) ? s_Clip.x2 - x1 : x1 - s_Clip.x1;
+        int lim_y = (sy > 0) ? s_Clip.y2 - y1 : y1 - s_Clip.y1;
+        if (dx >= dy) {
+            if (lim_x < n) n = lim_x;
+        } else {
+            if (lim_y < n) n = lim_y;
         }
-        if (e2 < dx) {
-            err += dx;
-            y1 += sy;
+
+        // 次轴只在其前进时检查是否越界
+        while (1) {
+            PLOT(x1, y1, color);
+            if (n-- == 0) break;
+            int e2 = 2 * err;
+            if (e2 > -dy) {
+                err -= dy;
+                x1 += sx;
+                if (dx < dy && (x1 < s_Clip.x1 || x1 > s_Clip.x2)) break;
+            }
+            if (e2 < dx) {
+                err += dx;
+                y1 += sy;
+                if (dx >= dy && (y1 < s_Clip.y1 || y1 > s_Clip.y2)) break;
+            }
+        }
+    } else {
+        while (1) {
+            PLOT(x1, y1, color);
+            if (n-- == 0) break;
+            int e2 = 2 * err;
+            if (e2 > -dy) { err -= dy; x1 += sx; }
+            if (e2 < dx)  { err += dx; y1 += sy; }
         }
     }
+
+    UC1638_MarkDirtyClipped(bx1, by1, bx2, by2);
+}
+
+void UC1638_DrawLine(int x1, int y1, int x2, int y2, LCD_Color_t color) {
+    UC1638_DrawLineAbs(x1 + s_OriginX, y1 + s_OriginY, x2 + s_OriginX, y2 + s_OriginY, color);
 }
 
 void UC1638_DrawRectangle(int x1, int y1, int x2, int y2, LCD_Color_t color) {
@@ -164,74 +609,88 @@ void UC1638_DrawRectangle(int x1, int y1, int x2, int y2, LCD_Color_t color) {
 void UC1638_DrawCircle(int x0, int y0, int r, LCD_Color_t color) {
     int a = 0, b = r;
     int d = 3 - (2 * r);
-    
-    // Bresenham Circle Algorithm
-    while (a <= b) {
-        UC1638_DrawPoint(x0 - b, y0 - a, color);
-        UC1638_DrawPoint(x0 + b, y0 - a, color);
-        UC1638_DrawPoint(x0 - a, y0 + b, color);
-        UC1638_DrawPoint(x0 - a, y0 - b, color);
-        UC1638_DrawPoint(x0 + b, y0 + a, color);
-        UC1638_DrawPoint(x0 + a, y0 - b, color);
-        UC1638_DrawPoint(x0 + a, y0 + b, color);
-        UC1638_DrawPoint(x0 - b, y0 + a, color);
-        
-        a++;
-        if (d < 0) {
-            d += 4 * a + 6;
-        } else {
-            d += 4 * (a - b) + 10;
-            b--;
-        }
-    }
-}
-
-// 优化的区域填充算法
-void UC1638_Fill(int x1, int y1, int x2, int y2, LCD_Color_t color) {
-    if (x1 >= LCD_WIDTH) x1 = LCD_WIDTH - 1;
-    if (x2 >= LCD_WIDTH) x2 = LCD_WIDTH - 1;
-    if (y1 >= LCD_HEIGHT) y1 = LCD_HEIGHT - 1;
-    if (y2 >= LCD_HEIGHT) y2 = LCD_HEIGHT - 1;
-
-    int page_start = y1 / 8;
-    int page_end = y2 / 8;
-    int row1 = y1 % 8;
-    int row2 = y2 % 8;
 
-    for (int page = page_start; page <= page_end; page++) {
-        int r_s = (page == page_start) ? row1 : 0;
-        int r_e = (page == page_end) ? row2 : 7;
-        
-        uint8_t mask = 0;
-        for (int i = r_s; i <= r_e; i++) {
-            mask |= (1 << i);
+    x0 += s_OriginX;
+    y0 += s_OriginY;
+    if (r < 0 || BOX_OUTSIDE(x0 - r, y0 - r, x0 + r, y0 + r)) return;
+
+    // 完全可见时内层不做任何检查；部分可见时逐点检查
+    if (BOX_INSIDE(x0 - r, y0 - r, x0 + r, y0 + r)) {
+        // Bresenham Circle Algorithm
+        while (a <= b) {
+            PLOT(x0 - b, y0 - a, color);
+            PLOT(x0 + b, y0 - a, color);
+            PLOT(x0 - a, y0 + b, color);
+            PLOT(x0 - a, y0 - b, color);
+            PLOT(x0 + b, y0 + a, color);
+            PLOT(x0 + a, y0 - b, color);
+            PLOT(x0 + a, y0 + b, color);
+            PLOT(x0 - b, y0 + a, color);
+
+            a++;
+            if (d < 0) {
+                d += 4 * a + 6;
+            } else {
+                d += 4 * (a - b) + 10;
+                b--;
+            }
         }
-
-        for (int col = x1; col <= x2; col++) {
-            int idx = page * LCD_WIDTH + col;
-            if (color == COLOR_BLACK) {
-                s_DisplayBuf[idx] |= mask;
+    } else {
+        while (a <= b) {
+            if (IN_CLIP(x0 - b, y0 - a)) PLOT(x0 - b, y0 - a, color);
+            if (IN_CLIP(x0 + b, y0 - a)) PLOT(x0 + b, y0 - a, color);
+            if (IN_CLIP(x0 - a, y0 + b)) PLOT(x0 - a, y0 + b, color);
+            if (IN_CLIP(x0 - a, y0 - b)) PLOT(x0 - a, y0 - b, color);
+            if (IN_CLIP(x0 + b, y0 + a)) PLOT(x0 + b, y0 + a, color);
+            if (IN_CLIP(x0 + a, y0 - b)) PLOT(x0 + a, y0 - b, color);
+            if (IN_CLIP(x0 + a, y0 + b)) PLOT(x0 + a, y0 + b, color);
+            if (IN_CLIP(x0 - b, y0 + a)) PLOT(x0 - b, y0 + a, color);
+
+            a++;
+            if (d < 0) {
+                d += 4 * a + 6;
             } else {
-                s_DisplayBuf[idx] &= ~mask;
+                d += 4 * (a - b) + 10;
+                b--;
             }
         }
     }
+
+    UC1638_MarkDirtyClipped(x0 - r, y0 - r, x0 + r, y0 + r);
+}
+
+// 优化的区域填充算法
+void UC1638_Fill(int x1, int y1, int x2, int y2, LCD_Color_t color) {
+    UC1638_FillAbs(x1 + s_OriginX, y1 + s_OriginY, x2 + s_OriginX, y2 + s_OriginY, color);
 }
 
 /* ================= 文本显示 ================= */
 
 void UC1638_ShowChar(int x, int y, char chr, LCD_Color_t color) {
     const uint8_t *pFont = Get_Font_Pointer(chr);
-    
-    // 6x12 Font, 逐列绘制
-    for (int h = 0; h < 12; h++) {
-        for (int w = 0; w < 6; w++) {
+
+    x += s_OriginX;
+    y += s_OriginY;
+
+    // 字符框与裁剪区求交，只遍历可见的行列
+    int w0 = (x < s_Clip.x1) ? s_Clip.x1 - x : 0;
+    int h0 = (y < s_Clip.y1) ? s_Clip.y1 - y : 0;
+    int w1 = (x + 5 > s_Clip.x2) ? s_Clip.x2 - x : 5;
+    int h1 = (y + 11 > s_Clip.y2) ? s_Clip.y2 - y : 11;
+    if (w0 > w1 || h0 > h1) return;
+
+    // 6x12 Font, 逐行绘制
+    for (int h = h0; h <= h1; h++) {
+        uint8_t bits = pFont[h] >> w0;
+        for (int w = w0; bits; w++, bits >>= 1) {
             // 检查字模中的位是否为1
-            if (pFont[h] & (1 << w)) {
-                UC1638_DrawPoint(x + w, y + h, color);
+            if ((bits & 1) && w <= w1) {
+                PLOT(x + w, y + h, color);
             }
         }
     }
+
+    UC1638_MarkDirty(x + w0, y + h0, x + w1, y + h1);
 }
 
 void UC1638_ShowString(int x, int y, const char *str, LCD_Color_t color) {
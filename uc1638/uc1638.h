@@ -15,11 +15,58 @@ typedef enum {
     COLOR_BLACK = 1
 } LCD_Color_t;
 
+// 显示方向 (顺时针旋转)
+typedef enum {
+    UC1638_ROTATE_0 = 0,
+    UC1638_ROTATE_90,
+    UC1638_ROTATE_180,
+    UC1638_ROTATE_270
+} UC1638_Rotation_t;
+
+// 矩形 (含两端边界)
+typedef struct {
+    int16_t x1, y1;
+    int16_t x2, y2;
+} UC1638_Rect_t;
+
 // 核心功能
 void UC1638_Init(void);
 void UC1638_Flush(void); // 将显存刷新到屏幕
+void UC1638_FlushDirty(void); // 仅刷新自上次刷新以来改动过的区域
+void UC1638_MarkDirty(int x1, int y1, int x2, int y2); // 直接改写显存后登记脏区
 void UC1638_Clear(LCD_Color_t color);
 
+// 扩展模块接口：显存按页排列 (s[page * LCD_WIDTH + x] 的 bit n 对应第 page*8+n 行)
+uint8_t *UC1638_GetBuffer(void);
+const uint8_t *UC1638_GetGlyph(char c); // 6x12 字模，12 字节，每字节一行，bit w 为第 w 列
+void UC1638_WriteRaw(uint8_t page, uint8_t x, const uint8_t *data, uint16_t len); // 绕过显存直写控制器 (仅 0/180 度)
+uint8_t UC1638_FlushFrameDMA(const uint8_t *frame); // 整帧突发写入外部缓冲，忙时返回 0 (仅 0/180 度)
+uint8_t UC1638_IsBusy(void);
+void UC1638_SPI_TxCpltHandler(void); // 在 HAL_SPI_TxCpltCallback 中调用
+// Flush / FlushDirty 结束时调用 (弱定义，可重写)：x_min/x_max 为刚发出的每页逻辑列范围，min > max 表示该页未发送
+void UC1638_FlushCpltCallback(const uint8_t *x_min, const uint8_t *x_max);
+
+// 方向控制：180° 与镜像由硬件 Map Control 完成，90°/270° 在刷新时转置显存；
+// 切换引起转置或列窗口变化时整屏登记为脏区，FlushDirty / Resume 会重发全屏
+void UC1638_SetRotation(UC1638_Rotation_t rot);
+UC1638_Rotation_t UC1638_GetRotation(void);
+void UC1638_SetMirror(uint8_t mirror_x, uint8_t mirror_y); // 在旋转之后作用于物理屏幕
+
+// 电源管理：省电期间保留控制器显存，唤醒无需复位与重新初始化
+void UC1638_SetContrast(uint8_t contrast);
+void UC1638_Sleep(void);
+void UC1638_Resume(void); // 退出省电并补刷休眠期间的改动
+
+// 图形上下文：裁剪栈 + 原点平移，坐标均相对当前原点
+void UC1638_SetClip(int x1, int y1, int x2, int y2);   // 替换当前裁剪区 (自动与屏幕求交)
+void UC1638_ResetClip(void);                            // 清空裁剪栈，原点归零，裁剪区恢复整屏
+void UC1638_PushClip(int x1, int y1, int x2, int y2);  // 保存当前上下文，裁剪区收窄为与给定矩形的交集
+void UC1638_PopClip(void);                              // 恢复上一层裁剪区与原点
+void UC1638_Translate(int dx, int dy);                  // 平移原点，随 Pop 一并恢复
+void UC1638_GetClip(UC1638_Rect_t *rect);               // 屏幕绝对坐标
+uint8_t UC1638_GetClipMask(int page);                   // 第 page 页位于裁剪区内的行掩码
+void UC1638_GetOrigin(int *x, int *y);
+
 // 绘图 API
 void UC1638_DrawPoint(int x, int y, LCD_Color_t color);
 void UC1638_DrawLine(int x1, int y1, int x2, int y2, LCD_Color_t color);
@@ -0,0 +1,160 @@
+/*
+ * uc1638_asset.c
+ * 压缩图像资源解码
+ * 逐页解码，运行段用 memset 展开，不需要整幅临时缓冲区
+ */
+
+#include "uc1638_asset.h"
+#include <string.h> // memset, memcpy
+
+// 非页对齐或直写 SPI 时使用的单页缓冲
+static uint8_t s_AssetRow[LCD_WIDTH];
+
+/* ================= 格式解析 ================= */
+
+uint8_t UC1638_Asset_Width(const uint8_t *asset) {
+    return asset[0];
+}
+
+uint8_t UC1638_Asset_Height(const uint8_t *asset) {
+    return asset[1] * 8;
+}
+
+// 第 page 页 RLE 流的起点
+static const uint8_t *UC1638_Asset_Page(const uint8_t *asset, uint8_t page) {
+    const uint8_t *index = asset + 2;
+    const uint8_t *data = index + asset[1] * 2;
+    uint16_t ofs = index[page * 2] | (index[page * 2 + 1] << 8);
+    return data + ofs;
+}
+
+// 解码一页：跳过前 skip 个字节，随后 count 个字节写入 dst
+static void UC1638_Asset_Unpack(const uint8_t *src, uint16_t skip, uint16_t count, uint8_t *dst) {
+    while (count > 0) {
+        uint8_t c = *src++;
+        uint16_t n;
+
+        if (c & 0x80) {
+            // 运行段
+            n = (c & 0x7F) + 2;
+            if (skip >= n) {
+                skip -= n;
+                src++;
+                continue;
+            }
+            n -= skip;
+            skip = 0;
+            if (n > count) n = count;
+            memset(dst, *src++, n);
+        } else {
+            // 原样段
+            n = c + 1;
+            if (skip >= n) {
+                skip -= n;
+                src += n;
+                continue;
+            }
+            src += skip;
+            n -= skip;
+            skip = 0;
+            if (n > count) n = count;
+            memcpy(dst, src, n);
+            src += n;
+        }
+
+        dst += n;
+        count -= n;
+    }
+}
+
+/* ================= 绘制 ================= */
+
+// 按掩码把一页数据合并进显存
+static void UC1638_Asset_Merge(uint8_t *d, const uint8_t *row, int w, int shift, uint8_t mask) {
+    if (shift >= 0) {
+        for (int c = 0; c < w; c++) d[c] = (d[c] & ~mask) | ((uint8_t)(row[c] << shift) & mask);
+    } else {
+        for (int c = 0; c < w; c++) d[c] = (d[c] & ~mask) | ((row[c] >> -shift) & mask);
+    }
+}
+
+void UC1638_Asset_DrawRegion(const uint8_t *asset, int sx, int sp, int w, int np, int x, int y) {
+    uint8_t *buf = UC1638_GetBuffer();
+    UC1638_Rect_t clip;
+    int ox, oy;
+    int shift;
+    int page0;
+
+    // 原点平移
+    UC1638_GetOrigin(&ox, &oy);
+    x += ox;
+    y += oy;
+
+    // 源区域裁剪
+    if (sx < 0) { w += sx; x -= sx; sx = 0; }
+    if (sp < 0) { np += sp; y -= sp * 8; sp = 0; }
+    if (sx + w > asset[0]) w = asset[0] - sx;
+    if (sp + np > asset[1]) np = asset[1] - sp;
+
+    // 按裁剪矩形做水平裁剪
+    UC1638_GetClip(&clip);
+    if (x < clip.x1) { sx += clip.x1 - x; w -= clip.x1 - x; x = clip.x1; }
+    if (x + w - 1 > clip.x2) w = clip.x2 - x + 1;
+    if (w <= 0 || np <= 0) return;
+
+    shift = y & 7;
+    page0 = y >> 3; // 向下取整，y 为负时同样成立
+
+    for (int i = 0; i < np; i++) {
+        int dp = page0 + i;
+        const uint8_t *src;
+        uint8_t m_hi; // 上页 (dp) 中本页数据覆盖且在裁剪区内的行
+        uint8_t m_lo; // 下页 (dp + 1)
+
+        if (dp >= LCD_PAGES) break;
+        m_hi = (dp >= 0) ? (uint8_t)((0xFF << shift) & UC1638_GetClipMask(dp)) : 0;
+        m_lo = (shift && dp + 1 < LCD_PAGES) ? (uint8_t)((0xFF >> (8 - shift)) & UC1638_GetClipMask(dp + 1)) : 0;
+        if (m_hi == 0 && m_lo == 0) continue;
+        src = UC1638_Asset_Page(asset, sp + i);
+
+        // 页对齐且整页可见：直接解码进显存
+        if (m_hi == 0xFF) {
+            UC1638_Asset_Unpack(src, sx, w, &buf[dp * LCD_WIDTH + x]);
+            continue;
+        }
+
+        // 其余情况：解码到行缓冲，移位并按掩码合并到一或两页
+        UC1638_Asset_Unpack(src, sx, w, s_AssetRow);
+        if (m_hi) UC1638_Asset_Merge(&buf[dp * LCD_WIDTH + x], s_AssetRow, w, shift, m_hi);
+        if (m_lo) UC1638_Asset_Merge(&buf[(dp + 1) * LCD_WIDTH + x], s_AssetRow, w, shift - 8, m_lo);
+    }
+
+    UC1638_MarkDirty(x, y, x + w - 1, y + np * 8 - 1);
+}
+
+void UC1638_Asset_Draw(const uint8_t *asset, int x, int y) {
+    UC1638_Asset_DrawRegion(asset, 0, 0, asset[0], asset[1], x, y);
+}
+
+void UC1638_Asset_Stream(const uint8_t *asset, int x, int page) {
+    int w = asset[0];
+    int skip = 0;
+
+    // 转置方向下物理页与显存页不对应，只能经显存刷新
+    if (UC1638_GetRotation() == UC1638_ROTATE_90 || UC1638_GetRotation() == UC1638_ROTATE_270) {
+        UC1638_Asset_Draw(asset, x, page * 8);
+        UC1638_FlushDirty();
+        return;
+    }
+
+    if (x < 0) { skip = -x; w += x; x = 0; }
+    if (x + w > LCD_WIDTH) w = LCD_WIDTH - x;
+    if (w <= 0) return;
+
+    for (int i = 0; i < asset[1]; i++) {
+        if (page + i < 0) continue;
+        if (page + i >= LCD_PAGES) break;
+        UC1638_Asset_Unpack(UC1638_Asset_Page(asset, i), skip, w, s_AssetRow);
+        UC1638_WriteRaw(page + i, x, s_AssetRow, w);
+    }
+}
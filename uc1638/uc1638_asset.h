@@ -0,0 +1,38 @@
+/*
+ * uc1638_asset.h
+ * 压缩图像资源：按页排列的 1bpp RLE 数据，解码直接写入显存或 SPI
+ * 资源数组由 tools/uc1638_asset_enc.py 生成
+ */
+
+#ifndef __UC1638_ASSET_H
+#define __UC1638_ASSET_H
+
+#include <stdint.h>
+#include "uc1638.h"
+
+/*
+ * 资源格式 (小端)：
+ *   [0]      宽度 (列数, 1~255)
+ *   [1]      页数 (高度 / 8，不足 8 行的部分补白)
+ *   [2..]    每页数据相对数据区起点的偏移 (uint16 * 页数)
+ *   数据区   每页一段 RLE 流，解码后恰为 宽度 个字节 (与显存同布局)
+ *
+ * RLE 控制字节 c：
+ *   c < 0x80   后跟 c + 1 个原样字节
+ *   c >= 0x80  下一字节重复 (c & 0x7F) + 2 次
+ */
+
+uint8_t UC1638_Asset_Width(const uint8_t *asset);
+uint8_t UC1638_Asset_Height(const uint8_t *asset); // 像素行数 (页数 * 8)
+
+// 整幅绘制到显存 (x, y) 处，y 可不按页对齐，超出屏幕部分自动裁剪
+void UC1638_Asset_Draw(const uint8_t *asset, int x, int y);
+
+// 绘制子区域 (精灵表)：源列 sx ~ sx+w-1，源页 sp ~ sp+np-1 (纵向以 8 行为单位)
+void UC1638_Asset_DrawRegion(const uint8_t *asset, int sx, int sp, int w, int np, int x, int y);
+
+// 逐页解码后直接经 SPI 写入控制器，不经过显存 (适合开机画面)
+// 显存内容保持不变；90/270 度时退化为写入显存再刷新脏区
+void UC1638_Asset_Stream(const uint8_t *asset, int x, int page);
+
+#endif /* __UC1638_ASSET_H */
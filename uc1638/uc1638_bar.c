@@ -0,0 +1,180 @@
+/*
+ * uc1638_bar.c
+ * 电平条 / 进度条实现
+ */
+
+#include "uc1638_bar.h"
+
+#include <stddef.h> // NULL
+
+/* ================= 几何 ================= */
+
+// 填充区 (边框与间隙之内)
+static void UC1638_Bar_Inner(const UC1638_Bar_t *bar, UC1638_Rect_t *r) {
+    int inset = bar->border ? 2 : 0;
+
+    r->x1 = bar->x + inset;
+    r->y1 = bar->y + inset;
+    r->x2 = bar->x + bar->w - 1 - inset;
+    r->y2 = bar->y + bar->h - 1 - inset;
+}
+
+// 沿填充方向的像素长度
+static int UC1638_Bar_Length(const UC1638_Rect_t *r, uint8_t dir) {
+    int len = (dir == UC1638_BAR_VERTICAL) ? r->y2 - r->y1 + 1 : r->x2 - r->x1 + 1;
+    return (len > 0) ? len : 0;
+}
+
+// 填充单位总数：连续填充为像素数，分段填充为完整的段数
+static int UC1638_Bar_Units(const UC1638_Bar_t *bar, int len) {
+    if (bar->seg == 0) return len;
+    return (len + bar->gap) / (bar->seg + bar->gap);
+}
+
+// 当前数值对应的填充单位数 (向下取整，只有满值时填满)
+static int UC1638_Bar_Level(const UC1638_Bar_t *bar) {
+    UC1638_Rect_t r;
+    UC1638_Bar_Inner(bar, &r);
+    return (int)(UC1638_Bar_Units(bar, UC1638_Bar_Length(&r, bar->dir)) * bar->value / bar->max);
+}
+
+/* ================= 绘制 ================= */
+
+// 沿填充方向的像素 [p0, p1] (0 为起点：横向最左列，纵向最下行)
+static void UC1638_Bar_FillPx(const UC1638_Bar_t *bar, const UC1638_Rect_t *r, int p0, int p1, LCD_Color_t color) {
+    if (bar->dir == UC1638_BAR_VERTICAL) {
+        UC1638_Fill(r->x1, r->y2 - p1, r->x2, r->y2 - p0, color);
+    } else {
+        UC1638_Fill(r->x1 + p0, r->y1, r->x1 + p1, r->y2, color);
+    }
+}
+
+// 填充/清除单位 [from, to)，dirty 返回改写区域的外接矩形
+static void UC1638_Bar_Span(const UC1638_Bar_t *bar, int from, int to, LCD_Color_t color, UC1638_Rect_t *dirty) {
+    UC1638_Rect_t r;
+    int pitch = bar->seg + bar->gap;
+    int p0, p1;
+
+    UC1638_Bar_Inner(bar, &r);
+
+    // 连续填充一次写完；分段时逐段写入，跳过间隔
+    if (bar->seg == 0) {
+        p0 = from;
+        p1 = to - 1;
+        UC1638_Bar_FillPx(bar, &r, p0, p1, color);
+    } else {
+        for (int k = from; k < to; k++) {
+            UC1638_Bar_FillPx(bar, &r, k * pitch, k * pitch + bar->seg - 1, color);
+        }
+        p0 = from * pitch;
+        p1 = (to - 1) * pitch + bar->seg - 1;
+    }
+
+    if (dirty) {
+        if (bar->dir == UC1638_BAR_VERTICAL) {
+            dirty->x1 = r.x1;
+            dirty->x2 = r.x2;
+            dirty->y1 = r.y2 - p1;
+            dirty->y2 = r.y2 - p0;
+        } else {
+            dirty->x1 = r.x1 + p0;
+            dirty->x2 = r.x1 + p1;
+            dirty->y1 = r.y1;
+            dirty->y2 = r.y2;
+        }
+    }
+}
+
+void UC1638_Bar_Init(UC1638_Bar_t *bar, int x, int y, int w, int h, UC1638_BarDir_t dir, int32_t max) {
+    bar->x = x;
+    bar->y = y;
+    bar->w = w;
+    bar->h = h;
+    bar->dir = dir;
+    bar->border = 1;
+    bar->seg = 0;
+    bar->gap = 0;
+    bar->ticks = 0;
+    bar->tick_len = 0;
+    bar->inverse = 0;
+    bar->max = (max > 0) ? max : 1;
+    bar->value = 0;
+    bar->level = -1;
+}
+
+void UC1638_Bar_SetBorder(UC1638_Bar_t *bar, uint8_t border) {
+    bar->border = border;
+    bar->level = -1;
+}
+
+void UC1638_Bar_SetSegments(UC1638_Bar_t *bar, uint8_t seg, uint8_t gap) {
+    bar->seg = seg;
+    bar->gap = seg ? gap : 0;
+    bar->level = -1;
+}
+
+void UC1638_Bar_SetTicks(UC1638_Bar_t *bar, uint8_t ticks, uint8_t len) {
+    bar->ticks = len ? ticks : 0;
+    bar->tick_len = len;
+    bar->level = -1;
+}
+
+void UC1638_Bar_SetInverse(UC1638_Bar_t *bar, uint8_t inverse) {
+    bar->inverse = inverse;
+    bar->level = -1;
+}
+
+void UC1638_Bar_Draw(UC1638_Bar_t *bar) {
+    UC1638_Rect_t r;
+    int x2 = bar->x + bar->w - 1;
+    int y2 = bar->y + bar->h - 1;
+    int len;
+    LCD_Color_t fg = bar->inverse ? COLOR_WHITE : COLOR_BLACK;
+    LCD_Color_t bg = bar->inverse ? COLOR_BLACK : COLOR_WHITE;
+
+    if (bar->w <= 0 || bar->h <= 0) return;
+
+    // 刻度在外框之外，一并清除
+    if (bar->dir == UC1638_BAR_VERTICAL) {
+        UC1638_Fill(bar->x, bar->y, x2 + bar->tick_len, y2, bg);
+    } else {
+        UC1638_Fill(bar->x, bar->y, x2, y2 + bar->tick_len, bg);
+    }
+    if (bar->border) UC1638_DrawRectangle(bar->x, bar->y, x2, y2, fg);
+
+    UC1638_Bar_Inner(bar, &r);
+    len = UC1638_Bar_Length(&r, bar->dir);
+
+    for (int i = 0; i < bar->ticks && len > 0; i++) {
+        int p = (bar->ticks > 1) ? i * (len - 1) / (bar->ticks - 1) : 0;
+        if (bar->dir == UC1638_BAR_VERTICAL) {
+            UC1638_Fill(x2 + 1, r.y2 - p, x2 + bar->tick_len, r.y2 - p, fg);
+        } else {
+            UC1638_Fill(r.x1 + p, y2 + 1, r.x1 + p, y2 + bar->tick_len, fg);
+        }
+    }
+
+    bar->level = (int16_t)UC1638_Bar_Level(bar);
+    if (bar->level > 0) UC1638_Bar_Span(bar, 0, bar->level, fg, NULL);
+}
+
+uint8_t UC1638_Bar_SetValue(UC1638_Bar_t *bar, int32_t value, UC1638_Rect_t *dirty) {
+    int level;
+
+    if (value < 0) value = 0;
+    if (value > bar->max) value = bar->max;
+    bar->value = value;
+    if (bar->level < 0) return 0;
+
+    // 只有跨过像素/段边界才改写显存
+    level = UC1638_Bar_Level(bar);
+    if (level == bar->level) return 0;
+
+    if (level > bar->level) {
+        UC1638_Bar_Span(bar, bar->level, level, bar->inverse ? COLOR_WHITE : COLOR_BLACK, dirty);
+    } else {
+        UC1638_Bar_Span(bar, level, bar->level, bar->inverse ? COLOR_BLACK : COLOR_WHITE, dirty);
+    }
+    bar->level = (int16_t)level;
+    return 1;
+}
@@ -0,0 +1,58 @@
+/*
+ * uc1638_bar.h
+ * 电平条 / 进度条：记住上次的填充长度，数值变化时只改写新旧长度之间的列 (横向)
+ * 或页字节 (纵向)，并返回恰好这一小块脏区
+ *
+ * 横向条从左向右填充，纵向条从下向上填充。
+ * 样式：
+ *   连续   按像素填充，数值变化 1 像素只改写 1 列 (横向) 或 1 行 (纵向)
+ *   分段   填充区由 seg 像素的段与 gap 像素的间隔组成，按整段点亮/熄灭
+ *   刻度   ticks 个刻度线均匀分布 (含两端)，画在边框外侧：横向条在下方，纵向条在右侧
+ * 控件结构体由调用者分配，不占用静态池；坐标遵循当前原点与裁剪区。
+ * uc1638_ui 的 BAR 控件同样由本模块绘制并增量更新。
+ *
+ * 用法：UC1638_Bar_Init -> (SetSegments / SetTicks) -> UC1638_Bar_Draw，
+ * 之后每次 UC1638_Bar_SetValue + UC1638_FlushDirty()。
+ */
+
+#ifndef __UC1638_BAR_H
+#define __UC1638_BAR_H
+
+#include <stdint.h>
+#include "uc1638.h"
+
+typedef enum {
+    UC1638_BAR_HORIZONTAL = 0,
+    UC1638_BAR_VERTICAL
+} UC1638_BarDir_t;
+
+typedef struct {
+    int16_t x, y, w, h;     // 外框 (不含刻度)
+    uint8_t dir;            // UC1638_BarDir_t
+    uint8_t border;         // 1 = 1 像素边框 + 1 像素间隙
+    uint8_t seg, gap;       // 分段长度与间隔，seg = 0 为连续填充
+    uint8_t ticks;          // 刻度数，0 = 无刻度
+    uint8_t tick_len;       // 刻度线长度
+    uint8_t inverse;        // 1 = 反色 (黑底白条)
+    int32_t max;            // max * 填充长度需小于 2^31
+    int32_t value;
+    int16_t level;          // 已画出的填充单位数 (像素或段)，-1 = 尚未绘制
+} UC1638_Bar_t;
+
+// 初始化 (带边框、连续填充、无刻度)，不绘制
+void UC1638_Bar_Init(UC1638_Bar_t *bar, int x, int y, int w, int h, UC1638_BarDir_t dir, int32_t max);
+
+// 样式修改后需重新 UC1638_Bar_Draw
+void UC1638_Bar_SetBorder(UC1638_Bar_t *bar, uint8_t border);
+void UC1638_Bar_SetSegments(UC1638_Bar_t *bar, uint8_t seg, uint8_t gap);
+void UC1638_Bar_SetTicks(UC1638_Bar_t *bar, uint8_t ticks, uint8_t len);
+void UC1638_Bar_SetInverse(UC1638_Bar_t *bar, uint8_t inverse);
+
+// 完整绘制边框、刻度与当前填充 (背景被覆盖之后也用它恢复)
+void UC1638_Bar_Draw(UC1638_Bar_t *bar);
+
+// 设置数值 (限制在 0..max)：只改写变化的部分，返回 1 表示显存有变化，
+// dirty 非空时返回改写区域 (与 Init 相同的坐标系)。尚未绘制时只记录数值
+uint8_t UC1638_Bar_SetValue(UC1638_Bar_t *bar, int32_t value, UC1638_Rect_t *dirty);
+
+#endif /* __UC1638_BAR_H */
@@ -28,10 +28,35 @@ extern SPI_HandleTypeDef hspi1;
 #define UC1638_CMD_MODE()   HAL_GPIO_WritePin(LCD_A0_GPIO_Port, LCD_A0_Pin, GPIO_PIN_RESET)
 #define UC1638_DATA_MODE()  HAL_GPIO_WritePin(LCD_A0_GPIO_Port, LCD_A0_Pin, GPIO_PIN_SET)
 
+// 5. SPI DMA (需在 CubeMX 中为 SPI TX 配置 DMA，并在 HAL_SPI_TxCpltCallback 中调用 UC1638_SPI_TxCpltHandler)
+//    置 0 时整帧突发写入退化为阻塞传输
+#define UC1638_USE_DMA      1
+
+// 6. 毫秒时基 (精灵帧率控制使用)，FreeRTOS 下可改为 (xTaskGetTickCount() * portTICK_PERIOD_MS)
+#define UC1638_GET_TICK()   HAL_GetTick()
+
+// 7. 显存镜像输出 (uc1638_mirror.c)：经调试串口输出屏幕内容，需为 UART TX 配置 DMA，
+//    并在 HAL_UART_TxCpltCallback 中调用 UC1638_Mirror_TxCpltHandler
+//    也可在编译选项中用 -DUC1638_USE_MIRROR=1 打开
+#ifndef UC1638_USE_MIRROR
+#define UC1638_USE_MIRROR   0
+#endif
+#if UC1638_USE_MIRROR
+extern UART_HandleTypeDef huart1;
+#define UC1638_MIRROR_UART  &huart1
+#endif
+
 /* ================= 屏幕参数定义 ================= */
 #define LCD_WIDTH           128
 #define LCD_HEIGHT          128
 #define LCD_PAGES           16  // 128 / 8 = 16页
 #define LCD_COL_OFFSET      55  // 物理屏幕偏移量 (移植自 Python 驱动)
+#define UC1638_SEG_NUM      240 // 控制器 SEG 总数 (列镜像时用于换算偏移)
+#define LCD_COL_OFFSET_MX   (UC1638_SEG_NUM - LCD_COL_OFFSET - LCD_WIDTH) // MX 镜像后的列偏移
+
+/* ================= 面板参数 ================= */
+// 代入 uc1638_seq.h 中的初始化序列
+#define LCD_CONTRAST        170 // Vbias 对比度
+#define LCD_BIAS            2   // 偏压比 BR (0xE8 | BR)
 
 #endif /* __UC1638_CONF_H */
@@ -0,0 +1,146 @@
+/*
+ * uc1638_dither.c
+ * 灰度抖动转换实现
+ */
+
+#include "uc1638_dither.h"
+#include <string.h> // memset
+
+// 8x8 Bayer 矩阵 (0~63)
+static const uint8_t s_Bayer8[8][8] = {
+    { 0, 32,  8, 40,  2, 34, 10, 42},
+    {48, 16, 56, 24, 50, 18, 58, 26},
+    {12, 44,  4, 36, 14, 46,  6, 38},
+    {60, 28, 52, 20, 62, 30, 54, 22},
+    { 3, 35, 11, 43,  1, 33,  9, 41},
+    {51, 19, 59, 27, 49, 17, 57, 25},
+    {15, 47,  7, 39, 13, 45,  5, 37},
+    {63, 31, 55, 23, 61, 29, 53, 21}
+};
+
+// 转换状态 (单实例)
+static struct {
+    UC1638_DitherMode_t mode;
+    int x;          // 可见区起始列
+    int skip;       // 源行左侧被裁掉的像素数
+    int w;          // 可见列数
+    int c0, c1;     // 其中位于裁剪区内、需要写入的列 (相对 x)
+    int y;          // 下一行的屏幕行号
+    uint8_t rows;   // 当前页已收集的行掩码
+} s_Dither;
+
+static uint8_t s_Acc[LCD_WIDTH];            // 当前页打包中的字节
+static int16_t s_Err[2][LCD_WIDTH + 2];     // Floyd-Steinberg 误差 (1/16 单位)，两端各留一格
+static uint8_t s_ErrCur;                    // 当前行误差缓冲下标
+
+// 把收集到的行合并进显存
+static void UC1638_Dither_Commit(void) {
+    if (s_Dither.rows != 0) {
+        int page = (s_Dither.y - 1) >> 3;
+
+        if (page >= 0 && page < LCD_PAGES && s_Dither.c0 <= s_Dither.c1) {
+            uint8_t mask = s_Dither.rows & UC1638_GetClipMask(page);
+            uint8_t *d = UC1638_GetBuffer() + page * LCD_WIDTH + s_Dither.x;
+
+            if (mask != 0) {
+                for (int c = s_Dither.c0; c <= s_Dither.c1; c++) {
+                    d[c] = (d[c] & ~mask) | (s_Acc[c] & mask);
+                }
+                UC1638_MarkDirty(s_Dither.x + s_Dither.c0, page * 8, s_Dither.x + s_Dither.c1, page * 8 + 7);
+            }
+        }
+    }
+
+    memset(s_Acc, 0, sizeof(s_Acc));
+    s_Dither.rows = 0;
+}
+
+void UC1638_Dither_Begin(int x, int y, int w, UC1638_DitherMode_t mode) {
+    UC1638_Rect_t clip;
+    int ox, oy;
+
+    UC1638_GetOrigin(&ox, &oy);
+    UC1638_GetClip(&clip);
+    x += ox;
+    y += oy;
+
+    s_Dither.mode = mode;
+    s_Dither.skip = 0;
+    s_Dither.y = y;
+    s_Dither.rows = 0;
+
+    // 只处理屏幕内的列；误差扩散仍按整个可见宽度计算，裁剪只限制写入，
+    // 局部重绘的结果与整幅绘制一致
+    if (x < 0) { s_Dither.skip = -x; w += x; x = 0; }
+    if (x + w > LCD_WIDTH) w = LCD_WIDTH - x;
+    s_Dither.x = x;
+    s_Dither.w = (w > 0) ? w : 0;
+    s_Dither.c0 = (clip.x1 > x) ? clip.x1 - x : 0;
+    s_Dither.c1 = (clip.x2 < x + s_Dither.w - 1) ? clip.x2 - x : s_Dither.w - 1;
+
+    memset(s_Acc, 0, sizeof(s_Acc));
+    memset(s_Err, 0, sizeof(s_Err));
+    s_ErrCur = 0;
+}
+
+void UC1638_Dither_Row(const uint8_t *gray) {
+    int y = s_Dither.y++;
+    uint8_t bit = (uint8_t)(1 << (y & 7));
+    const uint8_t *src = gray + s_Dither.skip;
+
+    if (s_Dither.mode == UC1638_DITHER_BAYER) {
+        const uint8_t *bayer = s_Bayer8[y & 7];
+        for (int c = 0; c < s_Dither.w; c++) {
+            // 阈值 2~254，纯黑纯白保持不变
+            if (src[c] < bayer[(s_Dither.x + c) & 7] * 4 + 2) s_Acc[c] |= bit;
+        }
+    } else {
+        int16_t *cur = s_Err[s_ErrCur] + 1;
+        int16_t *nxt = s_Err[s_ErrCur ^ 1] + 1;
+
+        for (int c = 0; c < s_Dither.w; c++) {
+            int v = src[c] + ((cur[c] + 8) >> 4);
+            int err;
+
+            if (v < 128) {
+                s_Acc[c] |= bit;
+                err = v;
+            } else {
+                err = v - 255;
+            }
+
+            // 7/16 右，3/16 左下，5/16 下，1/16 右下
+            cur[c + 1] += err * 7;
+            nxt[c - 1] += err * 3;
+            nxt[c] += err * 5;
+            nxt[c + 1] += err;
+        }
+
+        memset(s_Err[s_ErrCur], 0, sizeof(s_Err[0]));
+        s_ErrCur ^= 1;
+    }
+
+    if (y >= 0 && y < LCD_HEIGHT) s_Dither.rows |= bit;
+
+    // 凑满一页 (或已越过屏幕底部) 时写入
+    if ((y & 7) == 7) UC1638_Dither_Commit();
+}
+
+void UC1638_Dither_End(void) {
+    UC1638_Dither_Commit();
+}
+
+void UC1638_Dither_Image(int x, int y, int w, int h, const uint8_t *gray, int stride,
+                         UC1638_DitherMode_t mode) {
+    UC1638_Rect_t clip;
+    int ox, oy;
+
+    // 裁剪区下方的行不影响可见结果 (误差只向下扩散)，不再处理
+    UC1638_GetOrigin(&ox, &oy);
+    UC1638_GetClip(&clip);
+    UC1638_Dither_Begin(x, y, w, mode);
+    for (int r = 0; r < h && y + oy + r <= clip.y2; r++) {
+        UC1638_Dither_Row(gray + r * stride);
+    }
+    UC1638_Dither_End();
+}
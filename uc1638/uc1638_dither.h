@@ -0,0 +1,33 @@
+/*
+ * uc1638_dither.h
+ * 8 位灰度 -> 1bpp 显存的流式抖动转换
+ * 逐行输入，按页 (8 行) 打包后一次写入显存，每个显存字节只写一次
+ * 坐标遵循当前原点，写入限制在裁剪区内
+ */
+
+#ifndef __UC1638_DITHER_H
+#define __UC1638_DITHER_H
+
+#include <stdint.h>
+#include "uc1638.h"
+
+typedef enum {
+    UC1638_DITHER_BAYER = 0,    // 8x8 Bayer 有序抖动，无状态，适合动态画面
+    UC1638_DITHER_FLOYD         // Floyd-Steinberg 误差扩散，两行误差缓冲
+} UC1638_DitherMode_t;
+
+// 开始一幅 w 像素宽的灰度图，左上角位于 (x, y)
+// 灰度约定：0 = 黑 (置位)，255 = 白
+void UC1638_Dither_Begin(int x, int y, int w, UC1638_DitherMode_t mode);
+
+// 输入下一行 w 个灰度像素
+void UC1638_Dither_Row(const uint8_t *gray);
+
+// 结束并写入最后不足 8 行的页
+void UC1638_Dither_End(void);
+
+// 便捷接口：转换整幅 w x h 图像，相邻行间距 stride 字节
+void UC1638_Dither_Image(int x, int y, int w, int h, const uint8_t *gray, int stride,
+                         UC1638_DitherMode_t mode);
+
+#endif /* __UC1638_DITHER_H */
@@ -0,0 +1,193 @@
+/*
+ * uc1638_frc.c
+ * FRC 灰度实现：2bpp 缓冲 -> 两张位平面 -> 定时器轮流整帧刷出
+ */
+
+#include "uc1638_frc.h"
+#include <string.h> // memset
+
+// 2bpp 灰度缓冲：与显存同样按页排列，每个 uint16 存一列中的 8 个像素，
+// 第 n 行占 bit 2n (低位) 与 bit 2n+1 (高位)
+static uint16_t s_GrayBuf[LCD_PAGES * LCD_WIDTH];
+
+// 位平面双缓冲：s_Plane[缓冲][0 低位 (权重 1) / 1 高位 (权重 2)]
+// 定时器只发送前台缓冲，Commit 只改写后台缓冲，由定时器在周期边界交换
+static uint8_t s_Plane[2][2][LCD_PAGES * LCD_WIDTH];
+static volatile uint8_t s_Front = 0;
+static volatile uint8_t s_SwapPending = 0;  // 后台缓冲已就绪，等待交换
+static volatile uint8_t s_Writing = 0;      // Commit 正在改写后台缓冲，禁止交换
+
+// 每个缓冲相对灰度缓冲过期的列范围 (每页)
+static uint8_t s_StaleMin[2][LCD_PAGES];
+static uint8_t s_StaleMax[2][LCD_PAGES];
+
+// 子帧顺序：高位平面占 2/3，低位平面占 1/3
+static const uint8_t s_Schedule[3] = { 1, 1, 0 };
+
+// 灰度缓冲脏区 (每页列范围)
+static uint8_t s_GrayDirtyMin[LCD_PAGES];
+static uint8_t s_GrayDirtyMax[LCD_PAGES];
+
+static volatile uint8_t s_FrcRunning = 0;
+static uint8_t s_Phase = 0;
+static UC1638_FRC_Stats_t s_Stats;
+
+/* ================= 位平面 ================= */
+
+// 取出 16 位数中的偶数位并压缩为 8 位
+static uint8_t UC1638_FRC_Unzip(uint16_t v) {
+    v &= 0x5555;
+    v = (v | (v >> 1)) & 0x3333;
+    v = (v | (v >> 2)) & 0x0F0F;
+    v = (v | (v >> 4)) & 0x00FF;
+    return (uint8_t)v;
+}
+
+void UC1638_Gray_Commit(void) {
+    uint8_t back;
+
+    s_Writing = 1;
+    back = s_Front ^ 1; // 置 s_Writing 之后读取，定时器不会再交换
+
+    for (uint8_t page = 0; page < LCD_PAGES; page++) {
+        uint8_t x1 = s_GrayDirtyMin[page];
+        uint8_t x2 = s_GrayDirtyMax[page];
+
+        // 本次改动对两个缓冲都过期；前台缓冲的部分留到它成为后台时再补
+        if (x1 <= x2) {
+            for (uint8_t b = 0; b < 2; b++) {
+                if (x1 < s_StaleMin[b][page]) s_StaleMin[b][page] = x1;
+                if (x2 > s_StaleMax[b][page]) s_StaleMax[b][page] = x2;
+            }
+            s_GrayDirtyMin[page] = 0xFF;
+            s_GrayDirtyMax[page] = 0;
+        }
+
+        x1 = s_StaleMin[back][page];
+        x2 = s_StaleMax[back][page];
+        if (x1 > x2) continue;
+        for (int x = x1; x <= x2; x++) {
+            int idx = page * LCD_WIDTH + x;
+            uint16_t v = s_GrayBuf[idx];
+            s_Plane[back][0][idx] = UC1638_FRC_Unzip(v);
+            s_Plane[back][1][idx] = UC1638_FRC_Unzip(v >> 1);
+        }
+        s_Stats.commit_bytes += x2 - x1 + 1;
+        s_StaleMin[back][page] = 0xFF;
+        s_StaleMax[back][page] = 0;
+    }
+    s_Stats.commits++;
+
+    if (s_FrcRunning) {
+        s_SwapPending = 1;
+    } else {
+        s_Front = back;
+    }
+    s_Writing = 0;
+}
+
+/* ================= 灰度绘图 ================= */
+
+static void UC1638_Gray_MarkDirty(int page, int x1, int x2) {
+    if (x1 < s_GrayDirtyMin[page]) s_GrayDirtyMin[page] = x1;
+    if (x2 > s_GrayDirtyMax[page]) s_GrayDirtyMax[page] = x2;
+}
+
+void UC1638_Gray_Clear(uint8_t level) {
+    uint16_t v = (uint16_t)((level & 0x03) * 0x5555);
+
+    for (int i = 0; i < LCD_PAGES * LCD_WIDTH; i++) {
+        s_GrayBuf[i] = v;
+    }
+    for (int page = 0; page < LCD_PAGES; page++) {
+        UC1638_Gray_MarkDirty(page, 0, LCD_WIDTH - 1);
+    }
+}
+
+void UC1638_Gray_DrawPoint(int x, int y, uint8_t level) {
+    if (x < 0 || x >= LCD_WIDTH || y < 0 || y >= LCD_HEIGHT) return;
+
+    int page = y / 8;
+    int shift = (y % 8) * 2;
+    uint16_t *p = &s_GrayBuf[page * LCD_WIDTH + x];
+
+    *p = (*p & ~(0x03 << shift)) | ((level & 0x03) << shift);
+    UC1638_Gray_MarkDirty(page, x, x);
+}
+
+void UC1638_Gray_Fill(int x1, int y1, int x2, int y2, uint8_t level) {
+    uint16_t pattern = (uint16_t)((level & 0x03) * 0x5555);
+
+    if (x1 < 0) x1 = 0;
+    if (y1 < 0) y1 = 0;
+    if (x2 >= LCD_WIDTH) x2 = LCD_WIDTH - 1;
+    if (y2 >= LCD_HEIGHT) y2 = LCD_HEIGHT - 1;
+    if (x1 > x2 || y1 > y2) return;
+
+    for (int page = y1 / 8; page <= y2 / 8; page++) {
+        int r_s = (page == y1 / 8) ? y1 % 8 : 0;
+        int r_e = (page == y2 / 8) ? y2 % 8 : 7;
+
+        // 每行 2 位的掩码
+        uint16_t mask = (uint16_t)(((1UL << ((r_e - r_s + 1) * 2)) - 1) << (r_s * 2));
+        uint16_t *p = &s_GrayBuf[page * LCD_WIDTH];
+
+        for (int col = x1; col <= x2; col++) {
+            p[col] = (p[col] & ~mask) | (pattern & mask);
+        }
+        UC1638_Gray_MarkDirty(page, x1, x2);
+    }
+}
+
+/* ================= 子帧调度 ================= */
+
+void UC1638_FRC_Start(void) {
+    memset(s_GrayDirtyMin, 0xFF, sizeof(s_GrayDirtyMin));
+    memset(s_GrayDirtyMax, 0x00, sizeof(s_GrayDirtyMax));
+    memset(s_StaleMin, 0xFF, sizeof(s_StaleMin));
+    memset(s_StaleMax, 0x00, sizeof(s_StaleMax));
+    memset(&s_Stats, 0, sizeof(s_Stats));
+    s_FrcRunning = 0;
+    s_SwapPending = 0;
+    UC1638_Gray_Clear(0);
+    UC1638_Gray_Commit();
+    s_Phase = 0;
+    s_FrcRunning = 1;
+}
+
+void UC1638_FRC_Stop(void) {
+    s_FrcRunning = 0;
+    while (UC1638_IsBusy()) {
+        // 等待最后一个子帧发送完成
+    }
+    UC1638_Flush(); // 恢复单色显存内容
+}
+
+void UC1638_FRC_TimerHandler(void) {
+    if (!s_FrcRunning) return;
+
+    // 上一子帧尚未发完：跳过本次，保持当前相位
+    if (UC1638_IsBusy()) {
+        s_Stats.overruns++;
+        return;
+    }
+
+    // 只在一个周期 (高、高、低) 开始时交换，同一周期内的子帧来自同一份内容
+    if (s_Phase == 0 && s_SwapPending && !s_Writing) {
+        s_Front ^= 1;
+        s_SwapPending = 0;
+        s_Stats.swaps++;
+    }
+
+    if (!UC1638_FlushFrameDMA(s_Plane[s_Front][s_Schedule[s_Phase]])) {
+        s_Stats.overruns++;
+        return;
+    }
+
+    s_Stats.subframes++;
+    if (++s_Phase >= sizeof(s_Schedule)) s_Phase = 0;
+}
+
+void UC1638_FRC_GetStats(UC1638_FRC_Stats_t *stats) {
+    *stats = s_Stats;
+}
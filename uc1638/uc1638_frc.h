@@ -0,0 +1,49 @@
+/*
+ * uc1638_frc.h
+ * 软件帧率控制 (FRC) 4 级灰度
+ *
+ * 应用绘制到 2bpp 灰度缓冲，UC1638_Gray_Commit() 仅对改动区域重算两张位平面，
+ * 定时器中断按 {高位, 高位, 低位} 的顺序轮流整帧 DMA 刷出，
+ * 每个像素的点亮时间为 level / 3，视觉上呈现 4 级灰度。
+ * 位平面双缓冲：Commit 写后台缓冲，定时器在下一个周期开始时交换，
+ * DMA 读取中的子帧不会混入新旧内容 (位平面共占 8 KB RAM)。
+ *
+ * 刷新速率 (每子帧 2048 字节数据 + 5 字节命令，见 tests/test_frc.c)：
+ *   SPI 2 MHz  -> 子帧 8.2 ms，最高约 120 子帧/s，3 子帧一周期约 40 Hz (明显闪烁)
+ *   SPI 8 MHz  -> 子帧 2.1 ms，最高约 480 子帧/s，周期约 160 Hz
+ *   建议定时器频率取 150 ~ 200 Hz (周期 50 ~ 65 Hz)，SPI 时钟不低于 4 MHz
+ *
+ * FRC 期间 SPI 由定时器独占：不要调用 UC1638_Flush 等单色刷新接口。
+ * 位平面按物理布局生成，支持 0/180 度与镜像，不支持 90/270 度。
+ */
+
+#ifndef __UC1638_FRC_H
+#define __UC1638_FRC_H
+
+#include <stdint.h>
+#include "uc1638.h"
+
+// 灰度级：0 = 白，3 = 黑
+#define UC1638_GRAY_LEVELS  4
+
+typedef struct {
+    uint32_t subframes;     // 已发出的子帧数
+    uint32_t overruns;      // 定时器到期时上一子帧仍在传输而跳过的次数
+    uint32_t commits;       // 位平面重算次数
+    uint32_t commit_bytes;  // 累计重算的显存字节数
+    uint32_t swaps;         // 前后台缓冲交换次数
+} UC1638_FRC_Stats_t;
+
+// 启停：Start 之后在定时器周期中断里调用 UC1638_FRC_TimerHandler()
+void UC1638_FRC_Start(void);
+void UC1638_FRC_Stop(void);
+void UC1638_FRC_TimerHandler(void);
+void UC1638_FRC_GetStats(UC1638_FRC_Stats_t *stats);
+
+// 灰度绘图 (写入 2bpp 缓冲，需 Commit 后才会显示)
+void UC1638_Gray_Clear(uint8_t level);
+void UC1638_Gray_DrawPoint(int x, int y, uint8_t level);
+void UC1638_Gray_Fill(int x1, int y1, int x2, int y2, uint8_t level);
+void UC1638_Gray_Commit(void);
+
+#endif /* __UC1638_FRC_H */
@@ -0,0 +1,184 @@
+/*
+ * uc1638_label.c
+ * 静态文字缓存实现：固定槽位池 + LRU 淘汰
+ */
+
+#include "uc1638_label.h"
+#include <string.h> // memset, memcmp, memcpy
+
+#define LABEL_CHAR_W    6   // 6x12 字体
+#define LABEL_CHAR_H    12
+#define LABEL_MAX_W     (UC1638_LABEL_MAX_CHARS * LABEL_CHAR_W)
+#define LABEL_MAX_PAGES 3   // 相位 5~7 时 12 行跨 3 页
+
+typedef struct {
+    uint8_t used;
+    uint8_t font;
+    uint8_t phase;          // y % 8
+    uint8_t len;            // 字符数
+    uint8_t pages;          // 位图页数
+    uint16_t hash;
+    uint32_t stamp;         // 最近使用时刻 (LRU)
+    char text[UC1638_LABEL_MAX_CHARS];
+    uint8_t bitmap[LABEL_MAX_PAGES * LABEL_MAX_W]; // 按页排列，每页 len * 6 字节
+} UC1638_Label_Slot_t;
+
+static UC1638_Label_Slot_t s_Slots[UC1638_LABEL_SLOTS];
+static uint32_t s_Clock = 0;
+static UC1638_Label_Stats_t s_Stats;
+
+/* ================= 缓存查找 ================= */
+
+// FNV-1a，相位与字体一并参与，用于快速排除不匹配的槽
+static uint16_t UC1638_Label_Hash(const char *str, uint8_t len, uint8_t font, uint8_t phase) {
+    uint32_t h = 2166136261u;
+
+    h = (h ^ font) * 16777619u;
+    h = (h ^ phase) * 16777619u;
+    for (uint8_t i = 0; i < len; i++) {
+        h = (h ^ (uint8_t)str[i]) * 16777619u;
+    }
+    return (uint16_t)(h ^ (h >> 16));
+}
+
+static UC1638_Label_Slot_t *UC1638_Label_Find(const char *str, uint8_t len, uint8_t font, uint8_t phase, uint16_t hash) {
+    for (int i = 0; i < UC1638_LABEL_SLOTS; i++) {
+        UC1638_Label_Slot_t *s = &s_Slots[i];
+        if (s->used && s->hash == hash && s->len == len && s->font == font &&
+            s->phase == phase && memcmp(s->text, str, len) == 0) {
+            return s;
+        }
+    }
+    return 0;
+}
+
+// 空槽优先，否则取最久未使用的槽
+static UC1638_Label_Slot_t *UC1638_Label_Victim(void) {
+    UC1638_Label_Slot_t *victim = &s_Slots[0];
+
+    for (int i = 0; i < UC1638_LABEL_SLOTS; i++) {
+        if (!s_Slots[i].used) return &s_Slots[i];
+        if (s_Slots[i].stamp < victim->stamp) victim = &s_Slots[i];
+    }
+    s_Stats.evictions++;
+    return victim;
+}
+
+/* ================= 栅格化 ================= */
+
+static void UC1638_Label_Render(UC1638_Label_Slot_t *s) {
+    int w = s->len * LABEL_CHAR_W;
+
+    s->pages = (uint8_t)((s->phase + LABEL_CHAR_H + 7) / 8);
+    memset(s->bitmap, 0, s->pages * w);
+
+    for (int i = 0; i < s->len; i++) {
+        const uint8_t *pFont = UC1638_GetGlyph(s->text[i]);
+        uint8_t *col = &s->bitmap[i * LABEL_CHAR_W];
+
+        for (int h = 0; h < LABEL_CHAR_H; h++) {
+            int r = h + s->phase;
+            uint8_t *row = &col[(r >> 3) * w];
+            uint8_t bit = (uint8_t)(1 << (r & 7));
+
+            for (int c = 0; c < LABEL_CHAR_W; c++) {
+                if (pFont[h] & (1 << c)) row[c] |= bit;
+            }
+        }
+    }
+}
+
+/* ================= 绘制 ================= */
+
+static void UC1638_Label_Blit(const UC1638_Label_Slot_t *s, int x, int y, LCD_Color_t color) {
+    uint8_t *buf = UC1638_GetBuffer();
+    int w = s->len * LABEL_CHAR_W;
+    int c0 = 0;
+    int c1 = w - 1;
+    int page0 = y >> 3; // 向下取整，y 为负时同样成立
+    UC1638_Rect_t clip;
+
+    UC1638_GetClip(&clip);
+    if (x < clip.x1) c0 = clip.x1 - x;
+    if (x + c1 > clip.x2) c1 = clip.x2 - x;
+    if (c0 > c1) return;
+
+    for (int i = 0; i < s->pages; i++) {
+        int dp = page0 + i;
+        const uint8_t *src = &s->bitmap[i * w];
+        uint8_t *d;
+        uint8_t mask;
+
+        if (dp < 0) continue;
+        if (dp >= LCD_PAGES) break;
+        mask = UC1638_GetClipMask(dp);
+        if (mask == 0) continue;
+        d = &buf[dp * LCD_WIDTH];
+
+        if (color == COLOR_BLACK) {
+            for (int c = c0; c <= c1; c++) d[x + c] |= src[c] & mask;
+        } else {
+            for (int c = c0; c <= c1; c++) d[x + c] &= ~(src[c] & mask);
+        }
+    }
+
+    UC1638_MarkDirty(x + c0, y > clip.y1 ? y : clip.y1, x + c1,
+                     (y + LABEL_CHAR_H - 1 < clip.y2) ? y + LABEL_CHAR_H - 1 : clip.y2);
+}
+
+void UC1638_Label_Draw(int x, int y, const char *str, LCD_Color_t color) {
+    size_t n = strlen(str);
+    UC1638_Label_Slot_t *s;
+    uint8_t phase;
+    uint16_t hash;
+    int ox, oy;
+
+    if (n == 0) return;
+    if (n > UC1638_LABEL_MAX_CHARS) {
+        s_Stats.bypass++;
+        UC1638_ShowString(x, y, str, color);
+        return;
+    }
+
+    // 相位按屏幕绝对坐标计算
+    UC1638_GetOrigin(&ox, &oy);
+    x += ox;
+    y += oy;
+    phase = (uint8_t)(y & 7);
+
+    hash = UC1638_Label_Hash(str, (uint8_t)n, UC1638_LABEL_FONT_1206, phase);
+    s = UC1638_Label_Find(str, (uint8_t)n, UC1638_LABEL_FONT_1206, phase, hash);
+    if (s) {
+        s_Stats.hits++;
+    } else {
+        s_Stats.misses++;
+        s = UC1638_Label_Victim();
+        s->used = 1;
+        s->font = UC1638_LABEL_FONT_1206;
+        s->phase = phase;
+        s->len = (uint8_t)n;
+        s->hash = hash;
+        memcpy(s->text, str, n);
+        UC1638_Label_Render(s);
+    }
+    s->stamp = ++s_Clock;
+
+    UC1638_Label_Blit(s, x, y, color);
+}
+
+void UC1638_Label_Reset(void) {
+    memset(s_Slots, 0, sizeof(s_Slots));
+    s_Clock = 0;
+}
+
+void UC1638_Label_GetStats(UC1638_Label_Stats_t *stats) {
+    s_Stats.slots_used = 0;
+    s_Stats.bytes_used = 0;
+    for (int i = 0; i < UC1638_LABEL_SLOTS; i++) {
+        if (!s_Slots[i].used) continue;
+        s_Stats.slots_used++;
+        s_Stats.bytes_used += s_Slots[i].pages * s_Slots[i].len * LABEL_CHAR_W;
+    }
+    s_Stats.bytes_total = sizeof(s_Slots);
+    *stats = s_Stats;
+}
@@ -0,0 +1,45 @@
+/*
+ * uc1638_label.h
+ * 静态文字缓存：字符串首次绘制时按页栅格化为位图，之后只做掩码拷贝
+ *
+ * 缓存键为 (字符串内容, 字体, y 相位 = y % 8)。位图已按相位移好，
+ * 绘制时每列每页一次 "与/或"，不再逐字逐点查字模。
+ * 缓存槽为固定大小的静态池，满时淘汰最久未使用的槽 (LRU)。
+ * 颜色不参与键：同一位图既可黑字也可白字绘制 (背景保持不变，与 ShowString 一致)。
+ */
+
+#ifndef __UC1638_LABEL_H
+#define __UC1638_LABEL_H
+
+#include <stdint.h>
+#include "uc1638.h"
+
+#ifndef UC1638_LABEL_SLOTS
+#define UC1638_LABEL_SLOTS      8   // 缓存槽数
+#endif
+
+#ifndef UC1638_LABEL_MAX_CHARS
+#define UC1638_LABEL_MAX_CHARS  16  // 单槽可缓存的最长字符串，更长的直接走 ShowString
+#endif
+
+#define UC1638_LABEL_FONT_1206  0   // 目前只有 6x12 一种字体
+
+typedef struct {
+    uint32_t hits;          // 命中次数
+    uint32_t misses;        // 未命中 (需栅格化) 次数
+    uint32_t evictions;     // 淘汰次数
+    uint32_t bypass;        // 超长字符串未缓存、直接绘制的次数
+    uint16_t slots_used;    // 已占用槽数
+    uint16_t bytes_used;    // 已占用槽中位图的实际字节数
+    uint16_t bytes_total;   // 缓存池总占用 (含键与管理字段)
+} UC1638_Label_Stats_t;
+
+// 在 (x, y) 绘制字符串，用法同 UC1638_ShowString (遵循裁剪区与原点)
+void UC1638_Label_Draw(int x, int y, const char *str, LCD_Color_t color);
+
+// 清空缓存 (统计计数保留)
+void UC1638_Label_Reset(void);
+
+void UC1638_Label_GetStats(UC1638_Label_Stats_t *stats);
+
+#endif /* __UC1638_LABEL_H */
@@ -0,0 +1,212 @@
+/*
+ * uc1638_mirror.c
+ * 显存镜像实现：影子显存比较 -> 变化段 RLE 编码 -> UART DMA
+ */
+
+#include "uc1638_mirror.h"
+
+#if UC1638_USE_MIRROR
+
+#include <string.h> // memcpy, memset
+
+#define MIRROR_SYNC0        0xA5
+#define MIRROR_SYNC1        0x5A
+#define MIRROR_KEY          'K'
+#define MIRROR_DELTA        'D'
+#define MIRROR_HEAD         6   // 同步 2 + 类型 + 序号 + 长度 2
+#define MIRROR_SEG_HEAD     3   // 页 + 起始列 + 列数
+#define MIRROR_GAP          3   // 两段之间未变化的列不超过该值时合并为一段 (省去段头)
+
+// 一段 n 字节编码后的最大长度 (全部为原样段)
+#define MIRROR_SEG_MAX(n)   (MIRROR_SEG_HEAD + (n) + ((n) + 127) / 128)
+
+#if UC1638_MIRROR_BUF_SIZE < MIRROR_HEAD + 1 + LCD_PAGES * MIRROR_SEG_MAX(LCD_WIDTH)
+#error "UC1638_MIRROR_BUF_SIZE too small for a keyframe"
+#endif
+
+static uint8_t s_Panel[LCD_PAGES * LCD_WIDTH];     // 面板当前显示的内容 (各次刷新发出的部分)
+static uint8_t s_Shadow[LCD_PAGES * LCD_WIDTH];    // 上位机当前看到的内容
+static uint8_t s_TxBuf[UC1638_MIRROR_BUF_SIZE];
+static volatile uint8_t s_TxBusy = 0;
+static volatile uint8_t s_Pending = 0;              // 有刷新尚未镜像
+static uint8_t s_KeyReq = 1;
+static uint8_t s_Seq = 0;
+static uint16_t s_SinceKey = 0;
+static UC1638_Mirror_Stats_t s_Stats;
+
+/* ================= 编码 ================= */
+
+// 与 tools/uc1638_asset_enc.py 相同的 RLE，返回写入的字节数
+static uint16_t UC1638_Mirror_Rle(const uint8_t *src, uint16_t n, uint8_t *dst) {
+    uint8_t *out = dst;
+    uint16_t i = 0;
+    uint16_t lit = 0; // 当前原样段起点
+
+    while (i < n) {
+        uint16_t run = 1;
+        while (i + run < n && src[i + run] == src[i] && run < 129) run++;
+
+        // 两字节重复夹在原样段中间时不拆分，避免多一个控制字节
+        if (run >= 3 || (run == 2 && lit == i)) {
+            while (lit < i) {
+                uint16_t k = (i - lit > 128) ? 128 : i - lit;
+                *out++ = (uint8_t)(k - 1);
+                memcpy(out, &src[lit], k);
+                out += k;
+                lit += k;
+            }
+            *out++ = (uint8_t)(0x80 | (run - 2));
+            *out++ = src[i];
+            i += run;
+            lit = i;
+        } else {
+            i += run;
+        }
+    }
+    while (lit < n) {
+        uint16_t k = (n - lit > 128) ? 128 : n - lit;
+        *out++ = (uint8_t)(k - 1);
+        memcpy(out, &src[lit], k);
+        out += k;
+        lit += k;
+    }
+    return (uint16_t)(out - dst);
+}
+
+// 追加一段并同步影子显存；缓冲不足时返回 0
+static uint8_t UC1638_Mirror_Segment(const uint8_t *buf, uint8_t page, uint8_t x, uint8_t n, uint16_t *len) {
+    uint8_t *p = &s_TxBuf[*len];
+    const uint8_t *src = &buf[page * LCD_WIDTH + x];
+
+    if (*len + MIRROR_SEG_MAX(n) + 1 > UC1638_MIRROR_BUF_SIZE) return 0;
+
+    p[0] = page;
+    p[1] = x;
+    p[2] = n;
+    *len += MIRROR_SEG_HEAD + UC1638_Mirror_Rle(src, n, p + MIRROR_SEG_HEAD);
+    memcpy(&s_Shadow[page * LCD_WIDTH + x], src, n);
+    return 1;
+}
+
+// 增量：逐页找出与影子显存不同的列段；缓冲装满时停止，剩余部分留给下一个包
+static uint8_t UC1638_Mirror_Delta(const uint8_t *buf, uint16_t *len) {
+    for (uint8_t page = 0; page < LCD_PAGES; page++) {
+        const uint8_t *a = &buf[page * LCD_WIDTH];
+        const uint8_t *b = &s_Shadow[page * LCD_WIDTH];
+        int x = 0;
+
+        while (x < LCD_WIDTH) {
+            int start, end, same;
+
+            if (a[x] == b[x]) {
+                x++;
+                continue;
+            }
+
+            // 向后延伸，允许夹杂不超过 MIRROR_GAP 列的未变化列
+            start = x;
+            end = x;
+            same = 0;
+            for (x++; x < LCD_WIDTH && same <= MIRROR_GAP; x++) {
+                if (a[x] != b[x]) {
+                    end = x;
+                    same = 0;
+                } else {
+                    same++;
+                }
+            }
+            x = end + 1;
+
+            if (!UC1638_Mirror_Segment(buf, page, (uint8_t)start, (uint8_t)(end - start + 1), len)) return 0;
+        }
+    }
+    return 1;
+}
+
+/* ================= 发送 ================= */
+
+// 刷新路径中的钩子：只拷贝刚发出的列，显存中之后的改动要等下一次刷新
+void UC1638_FlushCpltCallback(const uint8_t *x_min, const uint8_t *x_max) {
+    const uint8_t *buf = UC1638_GetBuffer();
+
+    for (uint8_t page = 0; page < LCD_PAGES; page++) {
+        uint16_t at = page * LCD_WIDTH + x_min[page];
+        if (x_min[page] > x_max[page]) continue;
+        memcpy(&s_Panel[at], &buf[at], x_max[page] - x_min[page] + 1);
+    }
+    s_Pending = 1;
+}
+
+// 面板快照不清空：从 UC1638_Init 的整屏刷新起一直由刷新钩子维护
+void UC1638_Mirror_Init(void) {
+    memset(s_Shadow, 0, sizeof(s_Shadow));
+    memset(&s_Stats, 0, sizeof(s_Stats));
+    s_KeyReq = 1;
+    s_Pending = 1;
+    s_Seq = 0;
+    s_SinceKey = 0;
+}
+
+void UC1638_Mirror_RequestKeyframe(void) {
+    s_KeyReq = 1;
+    s_Pending = 1;
+}
+
+void UC1638_Mirror_Poll(void) {
+    const uint8_t *buf = s_Panel;
+    uint16_t len = MIRROR_HEAD;
+    uint8_t type;
+    uint8_t sum = 0;
+
+    if (s_TxBusy || !s_Pending) return;
+
+    if (s_KeyReq || s_SinceKey >= UC1638_MIRROR_KEYFRAME) {
+        type = MIRROR_KEY;
+        for (uint8_t page = 0; page < LCD_PAGES; page++) {
+            UC1638_Mirror_Segment(buf, page, 0, LCD_WIDTH, &len);
+        }
+        s_KeyReq = 0;
+        s_SinceKey = 0;
+        s_Pending = 0;
+        s_Stats.keyframes++;
+    } else {
+        type = MIRROR_DELTA;
+        s_Pending = 0;
+        if (!UC1638_Mirror_Delta(buf, &len)) {
+            s_Pending = 1; // 未发完的变化在下一个包继续
+            s_Stats.split++;
+        }
+        if (len == MIRROR_HEAD) return; // 内容没有变化
+        s_SinceKey++;
+    }
+
+    s_TxBuf[0] = MIRROR_SYNC0;
+    s_TxBuf[1] = MIRROR_SYNC1;
+    s_TxBuf[2] = type;
+    s_TxBuf[3] = s_Seq++;
+    s_TxBuf[4] = (uint8_t)(len - MIRROR_HEAD);
+    s_TxBuf[5] = (uint8_t)((len - MIRROR_HEAD) >> 8);
+    for (uint16_t i = 2; i < len; i++) sum += s_TxBuf[i];
+    s_TxBuf[len++] = sum;
+
+    s_TxBusy = 1;
+    if (HAL_UART_Transmit_DMA(UC1638_MIRROR_UART, s_TxBuf, len) != HAL_OK) {
+        // 影子显存已更新但数据未发出，只能用关键帧恢复同步
+        s_TxBusy = 0;
+        UC1638_Mirror_RequestKeyframe();
+        return;
+    }
+
+    s_Stats.packets++;
+    s_Stats.bytes += len;
+}
+
+void UC1638_Mirror_TxCpltHandler(void) {
+    s_TxBusy = 0;
+}
+
+void UC1638_Mirror_GetStats(UC1638_Mirror_Stats_t *stats) {
+    *stats = s_Stats;
+}
+
+#endif /* UC1638_USE_MIRROR */
@@ -0,0 +1,57 @@
+/*
+ * uc1638_mirror.h
+ * 显存镜像：每次刷新后把变化的页/列段经 UART DMA 发出，供上位机实时还原屏幕
+ * 上位机解码：tools/uc1638_mirror_dec.py
+ *
+ * 刷新路径中只把刚发出的列范围拷入面板快照 (UC1638_FlushCpltCallback)，比较与编码在
+ * UC1638_Mirror_Poll() 中完成，应在主循环空闲时调用；DMA 仍在发送时直接返回，
+ * 期间的多次刷新合并为一个增量包，不会拖慢 UC1638_Flush。
+ * 镜像内容为最近一次刷新送到面板的逻辑显存 (旋转之前的方向)，之后画了但尚未刷新的内容不会发出。
+ *
+ * 包格式：
+ *   0xA5 0x5A | 类型 | 序号 | 长度 (uint16 小端) | 负载 | 校验
+ *   类型   'K' 关键帧 (全部 16 页)，'D' 增量
+ *   序号   每包加 1，上位机据此发现丢包，丢包后等待下一个关键帧
+ *   校验   类型、序号、长度与负载逐字节累加的低 8 位
+ * 负载由若干段组成：页 | 起始列 | 列数 | 列数个字节的 RLE 流
+ * RLE 与 uc1638_asset.h 相同：c < 0x80 后跟 c + 1 个原样字节；c >= 0x80 下一字节重复 (c & 0x7F) + 2 次
+ *
+ * 占用 RAM：面板快照 2 KB + 影子显存 2 KB + 发送缓冲 UC1638_MIRROR_BUF_SIZE
+ */
+
+#ifndef __UC1638_MIRROR_H
+#define __UC1638_MIRROR_H
+
+#include <stdint.h>
+#include "uc1638.h"
+
+#ifndef UC1638_MIRROR_BUF_SIZE
+#define UC1638_MIRROR_BUF_SIZE      2176    // 需容纳最坏情况的关键帧 (约 2120 字节)
+#endif
+
+#ifndef UC1638_MIRROR_KEYFRAME
+#define UC1638_MIRROR_KEYFRAME      64      // 每隔多少个包插入一个关键帧
+#endif
+
+typedef struct {
+    uint32_t packets;       // 已发出的包数
+    uint32_t keyframes;     // 其中关键帧数
+    uint32_t bytes;         // 已发出的总字节数
+    uint32_t split;         // 变化过多、一个包装不下而分包的次数
+} UC1638_Mirror_Stats_t;
+
+// 清空影子显存，下一个包为关键帧
+void UC1638_Mirror_Init(void);
+
+// 主循环中调用：有变化且 UART 空闲时编码并启动 DMA 发送
+void UC1638_Mirror_Poll(void);
+
+// 在 HAL_UART_TxCpltCallback 中调用
+void UC1638_Mirror_TxCpltHandler(void);
+
+// 请求下一个包发送关键帧 (例如上位机刚连接)
+void UC1638_Mirror_RequestKeyframe(void);
+
+void UC1638_Mirror_GetStats(UC1638_Mirror_Stats_t *stats);
+
+#endif /* __UC1638_MIRROR_H */
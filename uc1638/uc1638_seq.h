@@ -0,0 +1,144 @@
+/*
+ * uc1638_seq.h
+ * UC1638 初始化 / 省电命令序列 (STM32 与 ESP32 两个移植共用)
+ * 只依赖 stdint.h，不包含任何平台头文件
+ */
+
+#ifndef __UC1638_SEQ_H
+#define __UC1638_SEQ_H
+
+#include <stdint.h>
+
+/* ================= 序列编码 ================= */
+// 每段以一个头字节开始：
+//   0x00          序列结束
+//   0x01 ~ 0x3F   后跟 n 个命令字节 (A0 = 0)
+//   0x41 ~ 0x7F   后跟 n 个数据字节 (A0 = 1)
+//   0x80 | id     一个面板参数字节，发送时按 UC1638_Panel_t 替换
+//   0xFF ms       延时 ms 毫秒
+#define UC1638_SEQ_END          0x00
+#define UC1638_SEQ_CMD(n)       (n)
+#define UC1638_SEQ_DATA(n)      (0x40 | (n))
+#define UC1638_SEQ_PARAM(id)    (0x80 | (id))
+#define UC1638_SEQ_DELAY        0xFF
+
+// 面板参数编号
+#define UC1638_P_BIAS           0 // 命令：0xE8 | BR
+#define UC1638_P_CONTRAST       1 // 数据：Vbias 电位器
+#define UC1638_P_MAP            2 // 命令：0xC0 | LC (MX/MY)
+#define UC1638_P_COL_START      3 // 数据：列偏移 / 窗口起始列
+#define UC1638_P_COL_END        4 // 数据：窗口结束列
+
+// 每块屏可能不同的参数
+typedef struct {
+    uint8_t contrast;   // 0x81 对比度 (Vbias)
+    uint8_t bias;       // 偏压比 BR[1:0]
+    uint8_t map;        // LCD Map Control 低 3 位
+    uint8_t col_offset; // 可见区起始 RAM 列
+    uint8_t width;      // 可见列数
+} UC1638_Panel_t;
+
+/* ================= 序列定义 ================= */
+
+// 上电初始化 (硬件复位之后发送)
+static const uint8_t UC1638_SEQ_INIT[] = {
+    UC1638_SEQ_CMD(1), 0xE2,                    // System Reset
+    UC1638_SEQ_DELAY, 5,
+    UC1638_SEQ_CMD(3), 0xA4, 0xA6, 0xB8,        // 全亮关 / 反显关 / LCD Control (MTP)
+    UC1638_SEQ_DATA(1), 0x00,
+    UC1638_SEQ_CMD(2), 0x2D, 0x20,              // 内部电荷泵 / 温度补偿
+    UC1638_SEQ_PARAM(UC1638_P_BIAS),            // 偏压
+    UC1638_SEQ_CMD(1), 0x81,
+    UC1638_SEQ_PARAM(UC1638_P_CONTRAST),        // 对比度
+    UC1638_SEQ_CMD(2), 0xA3, 0xC8,              // Line Rate / COM 扫描方向
+    UC1638_SEQ_DATA(1), 0x2F,
+    UC1638_SEQ_CMD(4), 0x89, 0x95, 0x84, 0xF1,  // RAM 地址控制 / COM0 / COM End
+    UC1638_SEQ_DATA(1), 127,
+    UC1638_SEQ_PARAM(UC1638_P_MAP),             // LCD Map Control
+    UC1638_SEQ_CMD(4), 0x86, 0x40, 0x50, 0x04,  // COM 扫描 / 滚动行 0 / 列地址
+    UC1638_SEQ_PARAM(UC1638_P_COL_START),
+    UC1638_SEQ_CMD(1), 0xF4,                    // 窗口起始列
+    UC1638_SEQ_PARAM(UC1638_P_COL_START),
+    UC1638_SEQ_CMD(1), 0xF6,                    // 窗口结束列
+    UC1638_SEQ_PARAM(UC1638_P_COL_END),
+    UC1638_SEQ_CMD(1), 0xF5,                    // 窗口起始页
+    UC1638_SEQ_DATA(1), 0,
+    UC1638_SEQ_CMD(1), 0xF7,                    // 窗口结束页
+    UC1638_SEQ_DATA(1), 15,
+    UC1638_SEQ_CMD(2), 0xF9, 0xC9,              // 窗口使能 / Display Enable
+    UC1638_SEQ_DATA(1), 0xAD,
+    UC1638_SEQ_END
+};
+
+// 进入省电：关显示 + 全亮，控制器保持显存 RAM 与寄存器
+static const uint8_t UC1638_SEQ_SLEEP[] = {
+    UC1638_SEQ_CMD(1), 0xC9,
+    UC1638_SEQ_DATA(1), 0xAC,
+    UC1638_SEQ_CMD(1), 0xA5,
+    UC1638_SEQ_END
+};
+
+// 退出省电：无需复位与重新初始化
+static const uint8_t UC1638_SEQ_WAKE[] = {
+    UC1638_SEQ_CMD(2), 0xA4, 0xC9,
+    UC1638_SEQ_DATA(1), 0xAD,
+    UC1638_SEQ_END
+};
+
+/* ================= 序列展开 ================= */
+
+// 从 *pp 取出下一批 A0 电平相同的字节 (参数已替换) 写入 out
+// 返回字节数，*is_cmd 给出电平；返回 0 时 *delay_ms 非 0 表示需延时，为 0 表示序列结束
+static uint16_t UC1638_Seq_Next(const uint8_t **pp, const UC1638_Panel_t *panel,
+                                uint8_t *out, uint16_t cap,
+                                uint8_t *is_cmd, uint8_t *delay_ms) {
+    const uint8_t *p = *pp;
+    uint16_t n = 0;
+
+    *delay_ms = 0;
+    while (*p != UC1638_SEQ_END) {
+        uint8_t hdr = *p;
+        uint8_t cmd;
+        uint8_t len;
+
+        if (hdr == UC1638_SEQ_DELAY) {
+            if (n == 0) {
+                *delay_ms = p[1];
+                p += 2;
+            }
+            break;
+        }
+
+        if (hdr & 0x80) {
+            uint8_t id = hdr & 0x7F;
+            cmd = (id == UC1638_P_BIAS || id == UC1638_P_MAP);
+            len = 1;
+        } else {
+            cmd = !(hdr & 0x40);
+            len = hdr & 0x3F;
+        }
+
+        if (n > 0 && (cmd != *is_cmd || n + len > cap)) break;
+        *is_cmd = cmd;
+
+        if (hdr & 0x80) {
+            switch (hdr & 0x7F) {
+                case UC1638_P_BIAS:      out[n] = 0xE8 | (panel->bias & 0x03); break;
+                case UC1638_P_CONTRAST:  out[n] = panel->contrast; break;
+                case UC1638_P_MAP:       out[n] = 0xC0 | (panel->map & 0x07); break;
+                case UC1638_P_COL_START: out[n] = panel->col_offset; break;
+                default:                 out[n] = panel->col_offset + panel->width - 1; break;
+            }
+            n++;
+            p++;
+        } else {
+            for (uint8_t i = 0; i < len; i++) out[n++] = p[1 + i];
+            p += 1 + len;
+        }
+    }
+
+    *pp = p;
+    return n;
+}
+
+#endif /* __UC1638_SEQ_H */
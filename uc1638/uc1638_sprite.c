@@ -0,0 +1,330 @@
+/*
+ * uc1638_sprite.c
+ * 精灵层实现：按页移位合成 + 受影响精灵的逆序擦除 / 顺序重绘
+ */
+
+#include "uc1638_sprite.h"
+#include <string.h> // memset
+
+#define SPRITE_SAVE_PAGES   (UC1638_SPRITE_MAX_PAGES + 1) // 非页对齐时跨一页
+
+typedef enum {
+    SPRITE_OP_XOR = 0,  // 绘制与擦除相同
+    SPRITE_OP_SAVE,     // 保存背景后叠加
+    SPRITE_OP_RESTORE   // 写回背景
+} UC1638_SpriteOp_t;
+
+typedef struct {
+    uint8_t used;
+    uint8_t mode;       // UC1638_SpriteMode_t
+    uint8_t visible;
+    uint8_t frame;
+    uint8_t period;     // 每 period 步换一帧
+    uint8_t count;      // 换帧计数
+    int16_t x, y;
+    int16_t vx, vy;
+    const UC1638_SpriteSheet_t *sheet;
+
+    // 当前显存中的状态
+    uint8_t drawn;
+    uint8_t dframe;
+    int16_t dx, dy;
+
+    uint8_t save[SPRITE_SAVE_PAGES * UC1638_SPRITE_MAX_W]; // SAVE 模式的背景
+} UC1638_Sprite_t;
+
+static UC1638_Sprite_t s_Sprites[UC1638_SPRITE_MAX];
+
+/* ================= 合成 ================= */
+
+// 在 (x, y) 处对第 frame 帧执行 op，只访问屏幕内的字节
+static void UC1638_Sprite_Apply(UC1638_Sprite_t *sp, int x, int y, uint8_t frame, UC1638_SpriteOp_t op) {
+    const UC1638_SpriteSheet_t *sh = sp->sheet;
+    uint8_t *buf = UC1638_GetBuffer();
+    int stride = sh->frame_w * sh->frames;
+    int shift = y & 7;
+    int page0 = y >> 3; // 向下取整，y 为负时同样成立
+    int np = sh->pages + (shift ? 1 : 0);
+    int c0 = (x < 0) ? -x : 0;
+    int c1 = (x + sh->frame_w > LCD_WIDTH) ? LCD_WIDTH - 1 - x : sh->frame_w - 1;
+
+    for (int j = 0; j < np; j++) {
+        int dp = page0 + j;
+        const uint8_t *hi = (j < sh->pages) ? &sh->data[j * stride + frame * sh->frame_w] : 0;
+        const uint8_t *lo = (shift && j > 0) ? &sh->data[(j - 1) * stride + frame * sh->frame_w] : 0;
+        uint8_t *save = &sp->save[j * UC1638_SPRITE_MAX_W];
+        uint8_t mask = 0xFF; // 本页中精灵覆盖的行
+        uint8_t *d;
+
+        if (dp < 0) continue;
+        if (dp >= LCD_PAGES) break;
+        if (j == 0) mask &= (uint8_t)(0xFF << shift);
+        if (j == sh->pages) mask &= (uint8_t)(0xFF >> (8 - shift));
+        d = &buf[dp * LCD_WIDTH];
+
+        for (int c = c0; c <= c1; c++) {
+            uint8_t v = 0;
+            if (hi) v |= (uint8_t)(hi[c] << shift);
+            if (lo) v |= (uint8_t)(lo[c] >> (8 - shift));
+
+            switch (op) {
+                case SPRITE_OP_XOR:
+                    d[x + c] ^= v;
+                    break;
+                case SPRITE_OP_SAVE:
+                    save[c] = d[x + c];
+                    d[x + c] |= v;
+                    break;
+                default:
+                    d[x + c] = (d[x + c] & ~mask) | (save[c] & mask);
+                    break;
+            }
+        }
+    }
+}
+
+static void UC1638_Sprite_Show(UC1638_Sprite_t *sp) {
+    UC1638_Sprite_Apply(sp, sp->x, sp->y, sp->frame, sp->mode == UC1638_SPRITE_SAVE ? SPRITE_OP_SAVE : SPRITE_OP_XOR);
+    sp->drawn = 1;
+    sp->dx = sp->x;
+    sp->dy = sp->y;
+    sp->dframe = sp->frame;
+}
+
+static void UC1638_Sprite_Hide(UC1638_Sprite_t *sp) {
+    UC1638_Sprite_Apply(sp, sp->dx, sp->dy, sp->dframe, sp->mode == UC1638_SPRITE_SAVE ? SPRITE_OP_RESTORE : SPRITE_OP_XOR);
+    sp->drawn = 0;
+}
+
+/* ================= 区域 ================= */
+
+static void UC1638_Sprite_Rect(const UC1638_Sprite_t *sp, int x, int y, UC1638_Rect_t *r) {
+    r->x1 = x;
+    r->y1 = y;
+    r->x2 = x + sp->sheet->frame_w - 1;
+    r->y2 = y + sp->sheet->pages * 8 - 1;
+}
+
+static uint8_t UC1638_Sprite_Overlap(const UC1638_Rect_t *a, const UC1638_Rect_t *b) {
+    return a->x1 <= b->x2 && b->x1 <= a->x2 && a->y1 <= b->y2 && b->y1 <= a->y2;
+}
+
+// 精灵 j 的已绘制或待绘制区域是否与 a 相交
+static uint8_t UC1638_Sprite_Touches(const UC1638_Sprite_t *sp, const UC1638_Rect_t *a) {
+    UC1638_Rect_t r;
+
+    if (sp->drawn) {
+        UC1638_Sprite_Rect(sp, sp->dx, sp->dy, &r);
+        if (UC1638_Sprite_Overlap(&r, a)) return 1;
+    }
+    if (sp->visible) {
+        UC1638_Sprite_Rect(sp, sp->x, sp->y, &r);
+        if (UC1638_Sprite_Overlap(&r, a)) return 1;
+    }
+    return 0;
+}
+
+static void UC1638_Sprite_AddDirty(const UC1638_Rect_t *r, UC1638_Rect_t *acc, uint8_t *any) {
+    UC1638_MarkDirty(r->x1, r->y1, r->x2, r->y2);
+    if (!*any) {
+        *acc = *r;
+        *any = 1;
+        return;
+    }
+    if (r->x1 < acc->x1) acc->x1 = r->x1;
+    if (r->y1 < acc->y1) acc->y1 = r->y1;
+    if (r->x2 > acc->x2) acc->x2 = r->x2;
+    if (r->y2 > acc->y2) acc->y2 = r->y2;
+}
+
+/* ================= 精灵 ================= */
+
+void UC1638_Sprite_Init(void) {
+    memset(s_Sprites, 0, sizeof(s_Sprites));
+}
+
+int UC1638_Sprite_Create(const UC1638_SpriteSheet_t *sheet, UC1638_SpriteMode_t mode, int x, int y) {
+    if (sheet->frames == 0) return UC1638_SPRITE_NONE;
+    if (mode == UC1638_SPRITE_SAVE &&
+        (sheet->frame_w > UC1638_SPRITE_MAX_W || sheet->pages > UC1638_SPRITE_MAX_PAGES)) {
+        return UC1638_SPRITE_NONE;
+    }
+
+    for (int i = 0; i < UC1638_SPRITE_MAX; i++) {
+        UC1638_Sprite_t *sp = &s_Sprites[i];
+        if (sp->used) continue;
+
+        memset(sp, 0, sizeof(*sp));
+        sp->used = 1;
+        sp->mode = (uint8_t)mode;
+        sp->visible = 1;
+        sp->sheet = sheet;
+        sp->x = x;
+        sp->y = y;
+        return i; // 下次 Tick 时绘制
+    }
+    return UC1638_SPRITE_NONE;
+}
+
+void UC1638_Sprite_Destroy(int id) {
+    if (id < 0 || id >= UC1638_SPRITE_MAX || !s_Sprites[id].used) return;
+
+    // 其后绘制的精灵可能保存了它的像素，全部擦除后由下次 Tick 重绘
+    if (s_Sprites[id].drawn) UC1638_Sprite_Erase();
+    s_Sprites[id].used = 0;
+}
+
+void UC1638_Sprite_MoveTo(int id, int x, int y) {
+    if (id < 0 || id >= UC1638_SPRITE_MAX || !s_Sprites[id].used) return;
+    s_Sprites[id].x = x;
+    s_Sprites[id].y = y;
+}
+
+void UC1638_Sprite_SetVelocity(int id, int vx, int vy) {
+    if (id < 0 || id >= UC1638_SPRITE_MAX || !s_Sprites[id].used) return;
+    s_Sprites[id].vx = vx;
+    s_Sprites[id].vy = vy;
+}
+
+void UC1638_Sprite_SetFrame(int id, uint8_t frame) {
+    if (id < 0 || id >= UC1638_SPRITE_MAX || !s_Sprites[id].used) return;
+    s_Sprites[id].frame = frame % s_Sprites[id].sheet->frames;
+}
+
+void UC1638_Sprite_SetAnim(int id, uint8_t period) {
+    if (id < 0 || id >= UC1638_SPRITE_MAX || !s_Sprites[id].used) return;
+    s_Sprites[id].period = period;
+    s_Sprites[id].count = 0;
+}
+
+void UC1638_Sprite_SetVisible(int id, uint8_t visible) {
+    if (id < 0 || id >= UC1638_SPRITE_MAX || !s_Sprites[id].used) return;
+    s_Sprites[id].visible = !!visible;
+}
+
+void UC1638_Sprite_Erase(void) {
+    // 逆序擦除：后绘制的精灵可能保存了先绘制精灵的像素
+    for (int i = UC1638_SPRITE_MAX - 1; i >= 0; i--) {
+        UC1638_Sprite_t *sp = &s_Sprites[i];
+        UC1638_Rect_t r;
+
+        if (!sp->used || !sp->drawn) continue;
+        UC1638_Sprite_Rect(sp, sp->dx, sp->dy, &r);
+        UC1638_Sprite_Hide(sp);
+        UC1638_MarkDirty(r.x1, r.y1, r.x2, r.y2);
+    }
+}
+
+uint8_t UC1638_Sprite_Tick(uint16_t steps, UC1638_Rect_t *dirty) {
+    uint8_t affected[UC1638_SPRITE_MAX];
+    uint8_t grow = 1;
+    uint8_t any = 0;
+    UC1638_Rect_t acc = { 0, 0, -1, -1 };
+
+    // 1. 推进位置与动画，找出状态变化的精灵
+    for (int i = 0; i < UC1638_SPRITE_MAX; i++) {
+        UC1638_Sprite_t *sp = &s_Sprites[i];
+
+        affected[i] = 0;
+        if (!sp->used) continue;
+
+        sp->x += sp->vx * steps;
+        sp->y += sp->vy * steps;
+        if (sp->period) {
+            uint16_t n = sp->count + steps;
+            sp->frame = (uint8_t)((sp->frame + n / sp->period) % sp->sheet->frames);
+            sp->count = (uint8_t)(n % sp->period);
+        }
+
+        if (sp->drawn != sp->visible ||
+            (sp->drawn && (sp->dx != sp->x || sp->dy != sp->y || sp->dframe != sp->frame))) {
+            affected[i] = 1;
+        }
+    }
+
+    // 2. 扩展受影响集合：位于其上方 (后绘制) 且相交的精灵需先擦除、后重绘
+    while (grow) {
+        grow = 0;
+        for (int a = 0; a < UC1638_SPRITE_MAX; a++) {
+            UC1638_Rect_t ra[2];
+            int n = 0;
+
+            if (!affected[a]) continue;
+            if (s_Sprites[a].drawn) UC1638_Sprite_Rect(&s_Sprites[a], s_Sprites[a].dx, s_Sprites[a].dy, &ra[n++]);
+            if (s_Sprites[a].visible) UC1638_Sprite_Rect(&s_Sprites[a], s_Sprites[a].x, s_Sprites[a].y, &ra[n++]);
+
+            for (int j = a + 1; j < UC1638_SPRITE_MAX; j++) {
+                if (affected[j] || !s_Sprites[j].used) continue;
+                for (int k = 0; k < n; k++) {
+                    if (UC1638_Sprite_Touches(&s_Sprites[j], &ra[k])) {
+                        affected[j] = 1;
+                        grow = 1;
+                        break;
+                    }
+                }
+            }
+        }
+    }
+
+    // 3. 逆序擦除旧位置
+    for (int i = UC1638_SPRITE_MAX - 1; i >= 0; i--) {
+        UC1638_Sprite_t *sp = &s_Sprites[i];
+        UC1638_Rect_t r;
+
+        if (!affected[i] || !sp->drawn) continue;
+        UC1638_Sprite_Rect(sp, sp->dx, sp->dy, &r);
+        UC1638_Sprite_Hide(sp);
+        UC1638_Sprite_AddDirty(&r, &acc, &any);
+    }
+
+    // 4. 顺序绘制新位置
+    for (int i = 0; i < UC1638_SPRITE_MAX; i++) {
+        UC1638_Sprite_t *sp = &s_Sprites[i];
+        UC1638_Rect_t r;
+
+        if (!affected[i] || !sp->visible) continue;
+        UC1638_Sprite_Show(sp);
+        UC1638_Sprite_Rect(sp, sp->x, sp->y, &r);
+        UC1638_Sprite_AddDirty(&r, &acc, &any);
+    }
+
+    if (dirty) *dirty = acc;
+    return any;
+}
+
+/* ================= 帧率控制 ================= */
+
+// 落后超过该帧数时不再追赶，直接从当前时刻重新计时
+#define PACER_MAX_CATCHUP   8
+
+void UC1638_Pacer_Init(UC1638_Pacer_t *pacer, uint16_t fps) {
+    pacer->period = (fps > 0) ? 1000 / fps : 1000;
+    if (pacer->period == 0) pacer->period = 1;
+    pacer->next = UC1638_GET_TICK() + pacer->period;
+    pacer->frames = 0;
+    pacer->skipped = 0;
+}
+
+uint16_t UC1638_Pacer_Poll(UC1638_Pacer_t *pacer) {
+    uint32_t now = UC1638_GET_TICK();
+    uint32_t late;
+    uint32_t steps;
+
+    // 无符号差值判断，tick 回绕后仍然正确
+    if ((int32_t)(now - pacer->next) < 0) return 0;
+
+    // 先按 32 位计算并限幅再收窄，长时间停顿后不会截断成 0
+    late = now - pacer->next;
+    steps = late / pacer->period + 1;
+    if (steps > PACER_MAX_CATCHUP) {
+        pacer->skipped += steps - 1;
+        pacer->next = now + pacer->period;
+        pacer->frames++;
+        return PACER_MAX_CATCHUP;
+    }
+
+    pacer->next += steps * pacer->period;
+    pacer->skipped += steps - 1;
+    pacer->frames++;
+    return (uint16_t)steps;
+}
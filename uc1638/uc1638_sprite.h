@@ -0,0 +1,84 @@
+/*
+ * uc1638_sprite.h
+ * 精灵层：在显存上叠加少量移动/动画小图，每帧只恢复并重绘精灵覆盖的字节
+ *
+ * 精灵表为未压缩的按页 1bpp 位图 (与显存同布局)，各帧横向排列：
+ *   data[page * (frame_w * frames) + frame * frame_w + col]
+ * 绘制方式：
+ *   XOR   与背景异或，再异或一次即擦除，不占额外内存
+ *   SAVE  绘制前保存覆盖的背景字节，擦除时原样写回；黑点叠加，白点透明
+ *
+ * 用法：主循环中 steps = UC1638_Pacer_Poll(&pacer)，steps > 0 时
+ * UC1638_Sprite_Tick(steps) 后调用 UC1638_FlushDirty()。
+ * 精灵只按屏幕边界裁剪，不受 UC1638_PushClip 影响。
+ * 修改精灵下方的背景前先调用 UC1638_Sprite_Erase()，下次 Tick 时重新绘制。
+ */
+
+#ifndef __UC1638_SPRITE_H
+#define __UC1638_SPRITE_H
+
+#include <stdint.h>
+#include "uc1638.h"
+
+#ifndef UC1638_SPRITE_MAX
+#define UC1638_SPRITE_MAX       8   // 精灵数
+#endif
+
+#ifndef UC1638_SPRITE_MAX_W
+#define UC1638_SPRITE_MAX_W     32  // SAVE 模式单帧最大宽度
+#endif
+
+#ifndef UC1638_SPRITE_MAX_PAGES
+#define UC1638_SPRITE_MAX_PAGES 4   // SAVE 模式单帧最大页数 (高度 / 8)
+#endif
+
+#define UC1638_SPRITE_NONE      (-1)
+
+typedef enum {
+    UC1638_SPRITE_XOR = 0,
+    UC1638_SPRITE_SAVE
+} UC1638_SpriteMode_t;
+
+typedef struct {
+    const uint8_t *data;
+    uint8_t frame_w;    // 单帧宽度 (列)
+    uint8_t pages;      // 单帧高度 (页)
+    uint8_t frames;     // 帧数
+} UC1638_SpriteSheet_t;
+
+/* ================= 精灵 ================= */
+
+void UC1638_Sprite_Init(void);
+
+// 创建精灵，返回编号 (失败返回 UC1638_SPRITE_NONE)；sheet 需保持有效
+int UC1638_Sprite_Create(const UC1638_SpriteSheet_t *sheet, UC1638_SpriteMode_t mode, int x, int y);
+void UC1638_Sprite_Destroy(int id);
+
+void UC1638_Sprite_MoveTo(int id, int x, int y);
+void UC1638_Sprite_SetVelocity(int id, int vx, int vy);    // 每步移动的像素数
+void UC1638_Sprite_SetFrame(int id, uint8_t frame);
+void UC1638_Sprite_SetAnim(int id, uint8_t period);        // 每 period 步换一帧，0 = 不自动换帧
+void UC1638_Sprite_SetVisible(int id, uint8_t visible);
+
+// 推进 steps 步 (位置与动画)，恢复并重绘变化的精灵，登记脏区
+// 返回 1 表示显存有变化，dirty 非空时返回变化区域的外接矩形
+uint8_t UC1638_Sprite_Tick(uint16_t steps, UC1638_Rect_t *dirty);
+
+// 从显存中移除全部精灵 (恢复背景)，下次 Tick 时重绘
+void UC1638_Sprite_Erase(void);
+
+/* ================= 帧率控制 ================= */
+
+typedef struct {
+    uint32_t period;    // 帧周期 (ms)
+    uint32_t next;      // 下一帧时刻
+    uint32_t frames;    // 已渲染帧数
+    uint32_t skipped;   // 因超时而合并跳过的帧数
+} UC1638_Pacer_t;
+
+void UC1638_Pacer_Init(UC1638_Pacer_t *pacer, uint16_t fps);
+
+// 非阻塞：未到下一帧返回 0；否则返回应推进的步数 (落后时 > 1，只渲染一次)
+uint16_t UC1638_Pacer_Poll(UC1638_Pacer_t *pacer);
+
+#endif /* __UC1638_SPRITE_H */
@@ -0,0 +1,355 @@
+/*
+ * uc1638_ui.c
+ * 保留模式控件层实现：静态控件池 + 损坏矩形合成
+ */
+
+#include "uc1638_ui.h"
+#include "uc1638_asset.h"
+#include "uc1638_bar.h"
+#include <string.h> // memset, strlen, strcmp
+
+#define UI_CHAR_W   6   // 6x12 字体
+#define UI_CHAR_H   12
+
+typedef struct {
+    uint8_t used;
+    uint8_t type;       // UC1638_UI_Type_t
+    uint8_t visible;
+    uint8_t inverse;    // 反色：白字黑底
+    int8_t parent;
+    UC1638_Rect_t rect; // 屏幕绝对坐标
+    union {
+        struct { const char *text; } label;
+        struct { int value; uint8_t len; } number;
+        struct { int value; int max; int16_t level; uint8_t pending; } bar; // level: 屏幕上的填充列数，-1 = 未绘制
+        struct { const uint8_t *asset; } icon;
+        struct { uint8_t border; } container;
+    } u;
+} UC1638_UI_Widget_t;
+
+static UC1638_UI_Widget_t s_Widgets[UC1638_UI_MAX_WIDGETS];
+static UC1638_Rect_t s_Damage[UC1638_UI_MAX_DAMAGE];
+static uint8_t s_DamageCount = 0;
+
+/* ================= 矩形运算 ================= */
+
+static uint8_t UI_Intersect(UC1638_Rect_t *r, const UC1638_Rect_t *a) {
+    if (a->x1 > r->x1) r->x1 = a->x1;
+    if (a->y1 > r->y1) r->y1 = a->y1;
+    if (a->x2 < r->x2) r->x2 = a->x2;
+    if (a->y2 < r->y2) r->y2 = a->y2;
+    return r->x1 <= r->x2 && r->y1 <= r->y2;
+}
+
+static void UI_Union(UC1638_Rect_t *r, const UC1638_Rect_t *a) {
+    if (a->x1 < r->x1) r->x1 = a->x1;
+    if (a->y1 < r->y1) r->y1 = a->y1;
+    if (a->x2 > r->x2) r->x2 = a->x2;
+    if (a->y2 > r->y2) r->y2 = a->y2;
+}
+
+static int32_t UI_Area(const UC1638_Rect_t *r) {
+    return (int32_t)(r->x2 - r->x1 + 1) * (r->y2 - r->y1 + 1);
+}
+
+/* ================= 损坏登记 ================= */
+
+static void UI_AddDamage(const UC1638_Rect_t *rect) {
+    UC1638_Rect_t r = *rect;
+    const UC1638_Rect_t screen = { 0, 0, LCD_WIDTH - 1, LCD_HEIGHT - 1 };
+    int best = 0;
+    int32_t best_cost = 0x7FFFFFFF;
+
+    if (!UI_Intersect(&r, &screen)) return;
+
+    // 与已有矩形相交则直接合并
+    for (int i = 0; i < s_DamageCount; i++) {
+        UC1638_Rect_t t = s_Damage[i];
+        if (UI_Intersect(&t, &r)) {
+            UI_Union(&s_Damage[i], &r);
+            return;
+        }
+    }
+
+    if (s_DamageCount < UC1638_UI_MAX_DAMAGE) {
+        s_Damage[s_DamageCount++] = r;
+        return;
+    }
+
+    // 列表已满：并入面积增量最小的矩形
+    for (int i = 0; i < s_DamageCount; i++) {
+        UC1638_Rect_t u = s_Damage[i];
+        int32_t cost;
+        UI_Union(&u, &r);
+        cost = UI_Area(&u) - UI_Area(&s_Damage[i]);
+        if (cost < best_cost) {
+            best_cost = cost;
+            best = i;
+        }
+    }
+    UI_Union(&s_Damage[best], &r);
+}
+
+void UC1638_UI_Invalidate(int id) {
+    if (id < 0 || id >= UC1638_UI_MAX_WIDGETS || !s_Widgets[id].used) return;
+    UI_AddDamage(&s_Widgets[id].rect);
+}
+
+/* ================= 控件创建 ================= */
+
+void UC1638_UI_Init(void) {
+    memset(s_Widgets, 0, sizeof(s_Widgets));
+    s_DamageCount = 0;
+}
+
+static int UI_Alloc(int parent, UC1638_UI_Type_t type, int x, int y, int w, int h) {
+    int ox = 0, oy = 0;
+
+    if (parent != UC1638_UI_ROOT) {
+        if (parent < 0 || parent >= UC1638_UI_MAX_WIDGETS || !s_Widgets[parent].used) return UC1638_UI_NONE;
+        ox = s_Widgets[parent].rect.x1;
+        oy = s_Widgets[parent].rect.y1;
+    }
+
+    for (int i = 0; i < UC1638_UI_MAX_WIDGETS; i++) {
+        UC1638_UI_Widget_t *wd = &s_Widgets[i];
+        if (wd->used) continue;
+
+        memset(wd, 0, sizeof(*wd));
+        wd->used = 1;
+        wd->type = type;
+        wd->visible = 1;
+        wd->parent = (int8_t)parent;
+        wd->rect.x1 = ox + x;
+        wd->rect.y1 = oy + y;
+        wd->rect.x2 = ox + x + w - 1;
+        wd->rect.y2 = oy + y + h - 1;
+        return i;
+    }
+    return UC1638_UI_NONE;
+}
+
+int UC1638_UI_Container(int parent, int x, int y, int w, int h, uint8_t border) {
+    int id = UI_Alloc(parent, UC1638_UI_CONTAINER, x, y, w, h);
+    if (id == UC1638_UI_NONE) return id;
+    s_Widgets[id].u.container.border = border;
+    UC1638_UI_Invalidate(id);
+    return id;
+}
+
+int UC1638_UI_Label(int parent, int x, int y, const char *text) {
+    int id = UI_Alloc(parent, UC1638_UI_LABEL, x, y, (int)strlen(text) * UI_CHAR_W, UI_CHAR_H);
+    if (id == UC1638_UI_NONE) return id;
+    s_Widgets[id].u.label.text = text;
+    UC1638_UI_Invalidate(id);
+    return id;
+}
+
+int UC1638_UI_Number(int parent, int x, int y, int len, int value) {
+    int id = UI_Alloc(parent, UC1638_UI_NUMBER, x, y, len * UI_CHAR_W, UI_CHAR_H);
+    if (id == UC1638_UI_NONE) return id;
+    s_Widgets[id].u.number.len = (uint8_t)len;
+    s_Widgets[id].u.number.value = value;
+    UC1638_UI_Invalidate(id);
+    return id;
+}
+
+int UC1638_UI_Bar(int parent, int x, int y, int w, int h, int max, int value) {
+    int id = UI_Alloc(parent, UC1638_UI_BAR, x, y, w, h);
+    if (id == UC1638_UI_NONE) return id;
+    s_Widgets[id].u.bar.max = (max > 0) ? max : 1;
+    s_Widgets[id].u.bar.value = value;
+    s_Widgets[id].u.bar.level = -1;
+    UC1638_UI_Invalidate(id);
+    return id;
+}
+
+int UC1638_UI_Icon(int parent, int x, int y, const uint8_t *asset) {
+    int id = UI_Alloc(parent, UC1638_UI_ICON, x, y, UC1638_Asset_Width(asset), UC1638_Asset_Height(asset));
+    if (id == UC1638_UI_NONE) return id;
+    s_Widgets[id].u.icon.asset = asset;
+    UC1638_UI_Invalidate(id);
+    return id;
+}
+
+/* ================= 属性修改 ================= */
+
+void UC1638_UI_SetText(int id, const char *text) {
+    UC1638_UI_Widget_t *wd;
+
+    if (id < 0 || id >= UC1638_UI_MAX_WIDGETS) return;
+    wd = &s_Widgets[id];
+    if (!wd->used || wd->type != UC1638_UI_LABEL) return;
+
+    // 同一指针时调用者可能已就地改写缓冲 (snprintf 后再 SetText)，无从比较，总是重绘；
+    // 不同指针只在内容不同时重绘
+    if (wd->u.label.text != text && strcmp(wd->u.label.text, text) == 0) {
+        wd->u.label.text = text;
+        return;
+    }
+
+    // 旧区域与新区域都需重绘 (文字长度可能变化)
+    UC1638_UI_Invalidate(id);
+    wd->u.label.text = text;
+    wd->rect.x2 = wd->rect.x1 + (int)strlen(text) * UI_CHAR_W - 1;
+    UC1638_UI_Invalidate(id);
+}
+
+void UC1638_UI_SetValue(int id, int value) {
+    UC1638_UI_Widget_t *wd;
+
+    if (id < 0 || id >= UC1638_UI_MAX_WIDGETS) return;
+    wd = &s_Widgets[id];
+    if (!wd->used) return;
+
+    if (wd->type == UC1638_UI_NUMBER) {
+        if (wd->u.number.value == value) return;
+        wd->u.number.value = value;
+    } else if (wd->type == UC1638_UI_BAR) {
+        // 不登记损坏：Render 时只改写新旧填充之间的列
+        if (wd->u.bar.value == value) return;
+        wd->u.bar.value = value;
+        wd->u.bar.pending = 1;
+        return;
+    } else {
+        return;
+    }
+    UC1638_UI_Invalidate(id);
+}
+
+void UC1638_UI_SetVisible(int id, uint8_t visible) {
+    if (id < 0 || id >= UC1638_UI_MAX_WIDGETS || !s_Widgets[id].used) return;
+    if (s_Widgets[id].visible == !!visible) return;
+    s_Widgets[id].visible = !!visible;
+    UC1638_UI_Invalidate(id);
+}
+
+void UC1638_UI_SetInverse(int id, uint8_t inverse) {
+    if (id < 0 || id >= UC1638_UI_MAX_WIDGETS || !s_Widgets[id].used) return;
+    if (s_Widgets[id].inverse == !!inverse) return;
+    s_Widgets[id].inverse = !!inverse;
+    UC1638_UI_Invalidate(id);
+}
+
+/* ================= 合成 ================= */
+
+// 求控件在 area 内的有效裁剪区 (与所有祖先容器求交)，不可见时返回 0
+static uint8_t UI_ClipFor(int id, const UC1638_Rect_t *area, UC1638_Rect_t *clip) {
+    *clip = *area;
+    for (int i = id; i != UC1638_UI_ROOT; i = s_Widgets[i].parent) {
+        if (!s_Widgets[i].visible) return 0;
+        if (!UI_Intersect(clip, &s_Widgets[i].rect)) return 0;
+    }
+    return 1;
+}
+
+// 由控件状态构造电平条 (边框 + 1 像素间隙，横向)，绘制与增量更新都交给 uc1638_bar
+static void UI_BarOf(const UC1638_UI_Widget_t *wd, UC1638_Bar_t *bar) {
+    const UC1638_Rect_t *r = &wd->rect;
+
+    UC1638_Bar_Init(bar, r->x1, r->y1, r->x2 - r->x1 + 1, r->y2 - r->y1 + 1, UC1638_BAR_HORIZONTAL, wd->u.bar.max);
+    UC1638_Bar_SetInverse(bar, wd->inverse);
+    UC1638_Bar_SetValue(bar, wd->u.bar.value, NULL); // 尚未绘制，只记录 (并限幅) 数值
+}
+
+// 控件上方 (z 序更高) 是否有可见控件与之重叠
+static uint8_t UI_Covered(int id) {
+    for (int i = id + 1; i < UC1638_UI_MAX_WIDGETS; i++) {
+        UC1638_Rect_t clip;
+        if (s_Widgets[i].used && UI_ClipFor(i, &s_Widgets[id].rect, &clip)) return 1;
+    }
+    return 0;
+}
+
+static void UI_Draw(UC1638_UI_Widget_t *wd) {
+    const UC1638_Rect_t *r = &wd->rect;
+    LCD_Color_t fg = wd->inverse ? COLOR_WHITE : COLOR_BLACK;
+
+    if (wd->inverse) UC1638_Fill(r->x1, r->y1, r->x2, r->y2, COLOR_BLACK);
+
+    switch (wd->type) {
+        case UC1638_UI_CONTAINER:
+            if (wd->u.container.border) UC1638_DrawRectangle(r->x1, r->y1, r->x2, r->y2, fg);
+            break;
+
+        case UC1638_UI_LABEL:
+            UC1638_ShowString(r->x1, r->y1, wd->u.label.text, fg);
+            break;
+
+        case UC1638_UI_NUMBER:
+            UC1638_ShowInt(r->x1, r->y1, wd->u.number.value, wd->u.number.len, fg);
+            break;
+
+        case UC1638_UI_BAR: {
+            UC1638_Bar_t bar;
+            UI_BarOf(wd, &bar);
+            UC1638_Bar_Draw(&bar);
+            wd->u.bar.level = bar.level;
+            wd->u.bar.pending = 0;
+            break;
+        }
+
+        case UC1638_UI_ICON:
+            UC1638_Asset_Draw(wd->u.icon.asset, r->x1, r->y1);
+            break;
+
+        default:
+            break;
+    }
+}
+
+// 数值变化的电平条只改写新旧填充之间的列；未绘制过或被上层控件遮挡时改为整体重绘
+static int UI_UpdateBars(void) {
+    int count = 0;
+
+    for (int i = 0; i < UC1638_UI_MAX_WIDGETS; i++) {
+        UC1638_UI_Widget_t *wd = &s_Widgets[i];
+        UC1638_Rect_t clip;
+        UC1638_Bar_t bar;
+
+        if (!wd->used || wd->type != UC1638_UI_BAR || !wd->u.bar.pending) continue;
+        wd->u.bar.pending = 0;
+        if (wd->u.bar.level < 0 || UI_Covered(i)) {
+            UC1638_UI_Invalidate(i);
+            continue;
+        }
+        if (!UI_ClipFor(i, &wd->rect, &clip)) continue; // 不可见：显示时会整体重绘
+
+        UI_BarOf(wd, &bar);
+        bar.level = wd->u.bar.level;
+        UC1638_PushClip(clip.x1, clip.y1, clip.x2, clip.y2);
+        if (UC1638_Bar_SetValue(&bar, wd->u.bar.value, NULL)) count++;
+        UC1638_PopClip();
+        wd->u.bar.level = bar.level;
+    }
+    return count;
+}
+
+int UC1638_UI_Render(void) {
+    int count;
+
+    // 先做增量更新，随后的损坏重绘按 z 序覆盖其上
+    count = UI_UpdateBars();
+    count += s_DamageCount;
+
+    for (int d = 0; d < s_DamageCount; d++) {
+        const UC1638_Rect_t *area = &s_Damage[d];
+
+        // 背景
+        UC1638_PushClip(area->x1, area->y1, area->x2, area->y2);
+        UC1638_Fill(area->x1, area->y1, area->x2, area->y2, COLOR_WHITE);
+
+        // 按 z 序 (池中顺序) 重绘相交的控件
+        for (int i = 0; i < UC1638_UI_MAX_WIDGETS; i++) {
+            UC1638_Rect_t clip;
+            if (!s_Widgets[i].used || !UI_ClipFor(i, area, &clip)) continue;
+            UC1638_PushClip(clip.x1, clip.y1, clip.x2, clip.y2);
+            UI_Draw(&s_Widgets[i]);
+            UC1638_PopClip();
+        }
+        UC1638_PopClip();
+    }
+
+    s_DamageCount = 0;
+    return count;
+}
@@ -0,0 +1,56 @@
+/*
+ * uc1638_ui.h
+ * 保留模式控件层：控件保存自身状态，属性变化时只登记自身区域为损坏，
+ * UC1638_UI_Render() 按创建顺序 (z 序) 只重绘损坏矩形，绘制结果进入驱动脏区，
+ * 随后调用 UC1638_FlushDirty() 即可局部刷新。
+ *
+ * 控件存放在静态池中，不使用 malloc。坐标相对于父容器左上角，
+ * 容器的矩形同时是子控件的裁剪区。
+ */
+
+#ifndef __UC1638_UI_H
+#define __UC1638_UI_H
+
+#include <stdint.h>
+#include "uc1638.h"
+
+#ifndef UC1638_UI_MAX_WIDGETS
+#define UC1638_UI_MAX_WIDGETS   24  // 控件池大小
+#endif
+
+#ifndef UC1638_UI_MAX_DAMAGE
+#define UC1638_UI_MAX_DAMAGE    8   // 损坏矩形上限，超出后合并
+#endif
+
+#define UC1638_UI_ROOT          (-1) // 以整屏为父容器
+#define UC1638_UI_NONE          (-1) // 创建失败 (控件池已满)
+
+typedef enum {
+    UC1638_UI_CONTAINER = 0,
+    UC1638_UI_LABEL,
+    UC1638_UI_NUMBER,
+    UC1638_UI_BAR,
+    UC1638_UI_ICON
+} UC1638_UI_Type_t;
+
+// 清空控件池与损坏列表
+void UC1638_UI_Init(void);
+
+// 创建控件，返回控件编号 (失败返回 UC1638_UI_NONE)
+int UC1638_UI_Container(int parent, int x, int y, int w, int h, uint8_t border);
+int UC1638_UI_Label(int parent, int x, int y, const char *text); // text 需保持有效
+int UC1638_UI_Number(int parent, int x, int y, int len, int value);
+int UC1638_UI_Bar(int parent, int x, int y, int w, int h, int max, int value);
+int UC1638_UI_Icon(int parent, int x, int y, const uint8_t *asset); // uc1638_asset 资源
+
+// 修改属性：值未变化时不产生损坏
+void UC1638_UI_SetText(int id, const char *text); // 就地改写同一缓冲后再次传入同一指针也会重绘
+void UC1638_UI_SetValue(int id, int value);     // NUMBER / BAR (BAR 只增量改写变化的列，见 uc1638_bar.h)
+void UC1638_UI_SetVisible(int id, uint8_t visible);
+void UC1638_UI_SetInverse(int id, uint8_t inverse);
+void UC1638_UI_Invalidate(int id);
+
+// 增量更新数值变化的电平条并重绘全部损坏矩形，返回更新的区域数 (0 表示无需刷新)
+int UC1638_UI_Render(void);
+
+#endif /* __UC1638_UI_H */
@@ -0,0 +1,307 @@
+/*
+ * uc1638_vector.c
+ * 定点矢量图形实现：凸多边形逐列扫描 -> 竖直段字节掩码填充
+ */
+
+#include "uc1638_vector.h"
+
+// 1/16 像素定点；像素 x 的中心为 x * 16 + 8
+#define VEC_SHIFT       4
+#define VEC_ONE         (1 << VEC_SHIFT)
+#define VEC_HALF        (VEC_ONE / 2)
+#define VEC_PIX(v)      ((v) * VEC_ONE + VEC_HALF)
+
+// 像素中心落在 [a, b] 内的第一个 / 最后一个像素 (算术右移即向下取整)
+#define VEC_FIRST(a)    (((a) - VEC_HALF + VEC_ONE - 1) >> VEC_SHIFT)
+#define VEC_LAST(b)     (((b) - VEC_HALF) >> VEC_SHIFT)
+
+// 角度单位：1/16 度
+#define VEC_DEG         16
+#define VEC_TURN        (360 * VEC_DEG)
+
+#define VEC_TOL         (VEC_ONE / 4)   // 弦高容差 1/4 像素
+#define VEC_MAX_DEPTH   10              // 贝塞尔细分最大深度 (最多 1024 段)
+
+// sin(0..90 度)，Q14
+static const int16_t s_SinTab[91] = {
+        0,   286,   572,   857,  1143,  1428,  1713,  1997,  2280,  2563,
+     2845,  3126,  3406,  3686,  3964,  4240,  4516,  4790,  5063,  5334,
+     5604,  5872,  6138,  6402,  6664,  6924,  7182,  7438,  7692,  7943,
+     8192,  8438,  8682,  8923,  9162,  9397,  9630,  9860, 10087, 10311,
+    10531, 10749, 10963, 11174, 11381, 11585, 11786, 11982, 12176, 12365,
+    12551, 12733, 12911, 13085, 13255, 13421, 13583, 13741, 13894, 14044,
+    14189, 14330, 14466, 14598, 14726, 14849, 14968, 15082, 15191, 15296,
+    15396, 15491, 15582, 15668, 15749, 15826, 15897, 15964, 16026, 16083,
+    16135, 16182, 16225, 16262, 16294, 16322, 16344, 16362, 16374, 16382,
+    16384,
+};
+
+/* ================= 定点数学 ================= */
+
+// a 以 1/16 度为单位，返回 Q14，相邻整度之间线性插值
+static int32_t UC1638_Vec_Sin(int32_t a) {
+    int32_t q, r, idx, v;
+
+    a %= VEC_TURN;
+    if (a < 0) a += VEC_TURN;
+    q = a / (90 * VEC_DEG);
+    r = a % (90 * VEC_DEG);
+    if (q & 1) r = 90 * VEC_DEG - r;
+
+    idx = r / VEC_DEG;
+    v = s_SinTab[idx];
+    if (idx < 90) v += (s_SinTab[idx + 1] - v) * (r % VEC_DEG) / VEC_DEG;
+    return (q >= 2) ? -v : v;
+}
+
+static int32_t UC1638_Vec_Cos(int32_t a) {
+    return UC1638_Vec_Sin(a + 90 * VEC_DEG);
+}
+
+static uint32_t UC1638_Vec_Sqrt(uint32_t v) {
+    uint32_t r = 0;
+    uint32_t bit = 1UL << 30;
+
+    while (bit > v) bit >>= 2;
+    while (bit) {
+        if (v >= r + bit) {
+            v -= r + bit;
+            r = (r >> 1) + bit;
+        } else {
+            r >>= 1;
+        }
+        bit >>= 2;
+    }
+    return r;
+}
+
+static int32_t UC1638_Vec_Abs(int32_t v) {
+    return (v < 0) ? -v : v;
+}
+
+/* ================= 扫描填充 ================= */
+
+// 可见列范围 (用户坐标)，避免在裁剪区外空转
+static void UC1638_Vec_Columns(int *x1, int *x2) {
+    UC1638_Rect_t clip;
+    int ox, oy;
+
+    UC1638_GetClip(&clip);
+    UC1638_GetOrigin(&ox, &oy);
+    if (*x1 < clip.x1 - ox) *x1 = clip.x1 - ox;
+    if (*x2 > clip.x2 - ox) *x2 = clip.x2 - ox;
+}
+
+// 第 x 列中 [top, bot] (定点) 覆盖的像素
+static void UC1638_Vec_Span(int x, int32_t top, int32_t bot, LCD_Color_t color) {
+    int y1 = VEC_FIRST(top);
+    int y2 = VEC_LAST(bot);
+
+    if (y1 <= y2) UC1638_Fill(x, y1, x, y2, color);
+}
+
+// 凸多边形 (定点顶点)
+static void UC1638_Vec_FillConvex(const int32_t *px, const int32_t *py, int n, LCD_Color_t color) {
+    int32_t minx = px[0], maxx = px[0];
+    int x1, x2;
+
+    for (int i = 1; i < n; i++) {
+        if (px[i] < minx) minx = px[i];
+        if (px[i] > maxx) maxx = px[i];
+    }
+    x1 = VEC_FIRST(minx);
+    x2 = VEC_LAST(maxx);
+    UC1638_Vec_Columns(&x1, &x2);
+
+    for (int x = x1; x <= x2; x++) {
+        int32_t cx = VEC_PIX(x);
+        int32_t top = INT32_MAX, bot = INT32_MIN;
+
+        for (int i = 0; i < n; i++) {
+            int32_t ax = px[i], ay = py[i];
+            int32_t bx = px[(i + 1) % n], by = py[(i + 1) % n];
+            int32_t y;
+
+            if ((cx < ax && cx < bx) || (cx > ax && cx > bx)) continue;
+            if (ax == bx) {
+                // 竖直边恰好落在列中心上：两个端点都计入
+                if (ay < top) top = ay;
+                if (ay > bot) bot = ay;
+                y = by;
+            } else {
+                y = ay + (cx - ax) * (by - ay) / (bx - ax);
+            }
+            if (y < top) top = y;
+            if (y > bot) bot = y;
+        }
+        if (top <= bot) UC1638_Vec_Span(x, top, bot, color);
+    }
+}
+
+// 实心圆 (定点圆心与半径)，用作圆头与折线连接处
+static void UC1638_Vec_FillDisc(int32_t cx, int32_t cy, int32_t r, LCD_Color_t color) {
+    int x1 = VEC_FIRST(cx - r);
+    int x2 = VEC_LAST(cx + r);
+
+    UC1638_Vec_Columns(&x1, &x2);
+    for (int x = x1; x <= x2; x++) {
+        int32_t d = VEC_PIX(x) - cx;
+        int32_t h = (int32_t)UC1638_Vec_Sqrt((uint32_t)(r * r - d * d));
+        UC1638_Vec_Span(x, cy - h, cy + h, color);
+    }
+}
+
+// 半宽为 hw 的平头线段 (定点)
+static void UC1638_Vec_Segment(int32_t ax, int32_t ay, int32_t bx, int32_t by, int32_t hw, LCD_Color_t color) {
+    int32_t dx = bx - ax, dy = by - ay;
+    int32_t len = (int32_t)UC1638_Vec_Sqrt((uint32_t)(dx * dx + dy * dy));
+    int32_t nx, ny;
+    int32_t px[4], py[4];
+
+    if (len == 0) return;
+    nx = -dy * hw / len;
+    ny = dx * hw / len;
+
+    px[0] = ax + nx; py[0] = ay + ny;
+    px[1] = bx + nx; py[1] = by + ny;
+    px[2] = bx - nx; py[2] = by - ny;
+    px[3] = ax - nx; py[3] = ay - ny;
+    UC1638_Vec_FillConvex(px, py, 4, color);
+}
+
+/* ================= 折线画笔 ================= */
+// 曲线细分后的各点依次交给画笔：细线走 Bresenham，粗线为线段 + 圆形连接
+
+static struct {
+    int32_t x, y;   // 上一点 (定点)
+    int32_t hw;     // 半线宽 (定点)，0 表示细线
+    LCD_Color_t color;
+} s_Pen;
+
+static void UC1638_Vec_PenStart(int32_t x, int32_t y, int width, LCD_Color_t color) {
+    s_Pen.x = x;
+    s_Pen.y = y;
+    s_Pen.hw = (width > 1) ? width * VEC_HALF : 0;
+    s_Pen.color = color;
+    if (s_Pen.hw) UC1638_Vec_FillDisc(x, y, s_Pen.hw, color);
+}
+
+static void UC1638_Vec_PenTo(int32_t x, int32_t y) {
+    if (s_Pen.hw) {
+        UC1638_Vec_Segment(s_Pen.x, s_Pen.y, x, y, s_Pen.hw, s_Pen.color);
+        UC1638_Vec_FillDisc(x, y, s_Pen.hw, s_Pen.color);
+    } else {
+        UC1638_DrawLine(s_Pen.x >> VEC_SHIFT, s_Pen.y >> VEC_SHIFT, x >> VEC_SHIFT, y >> VEC_SHIFT, s_Pen.color);
+    }
+    s_Pen.x = x;
+    s_Pen.y = y;
+}
+
+/* ================= 图元 ================= */
+
+void UC1638_DrawThickLine(int x1, int y1, int x2, int y2, int width, LCD_Color_t color) {
+    if (width <= 1) {
+        UC1638_DrawLine(x1, y1, x2, y2, color);
+        return;
+    }
+    UC1638_Vec_PenStart(VEC_PIX(x1), VEC_PIX(y1), width, color);
+    UC1638_Vec_PenTo(VEC_PIX(x2), VEC_PIX(y2));
+}
+
+void UC1638_Polar(int x0, int y0, int r, int angle, int *x, int *y) {
+    int32_t a = (int32_t)angle * VEC_DEG;
+    *x = x0 + (int)((r * UC1638_Vec_Cos(a) + (1 << 13)) >> 14);
+    *y = y0 + (int)((r * UC1638_Vec_Sin(a) + (1 << 13)) >> 14);
+}
+
+void UC1638_DrawArc(int x0, int y0, int r, int start, int end, int width, LCD_Color_t color) {
+    int32_t cx = VEC_PIX(x0), cy = VEC_PIX(y0);
+    int32_t hw = (width > 1) ? width * VEC_HALF : 0;
+    int32_t ro = r * VEC_ONE + hw;                      // 外半径
+    int32_t ri = r * VEC_ONE - hw;                      // 内半径
+    int32_t a0 = (int32_t)start * VEC_DEG;
+    int32_t sweep = ((int32_t)end - start) * VEC_DEG;
+    int32_t step = 45 * VEC_DEG;
+    int32_t n;
+    int32_t px[4], py[4];
+
+    if (r <= 0) return;
+    if (ri < 0) ri = 0;
+    while (sweep <= 0) sweep += VEC_TURN;
+    if (sweep > VEC_TURN) sweep = VEC_TURN;
+
+    // 按外半径自适应选取步长：弦高 r * (1 - cos(step / 2)) 不超过容差
+    while (step > 1 && ((ro * (16384 - UC1638_Vec_Cos(step / 2))) >> 14) > VEC_TOL) {
+        step /= 2;
+    }
+    n = (sweep + step - 1) / step;
+
+    // 相邻两个角度之间：细线为一段弦，粗线为内外弦围成的四边形
+    px[1] = cx + ((ro * UC1638_Vec_Cos(a0)) >> 14);
+    py[1] = cy + ((ro * UC1638_Vec_Sin(a0)) >> 14);
+    px[2] = cx + ((ri * UC1638_Vec_Cos(a0)) >> 14);
+    py[2] = cy + ((ri * UC1638_Vec_Sin(a0)) >> 14);
+    if (!hw) UC1638_Vec_PenStart(px[1], py[1], 1, color);
+
+    for (int32_t i = 1; i <= n; i++) {
+        int32_t a = a0 + sweep * i / n;
+        int32_t c = UC1638_Vec_Cos(a);
+        int32_t s = UC1638_Vec_Sin(a);
+
+        px[0] = px[1]; py[0] = py[1];
+        px[3] = px[2]; py[3] = py[2];
+        px[1] = cx + ((ro * c) >> 14);
+        py[1] = cy + ((ro * s) >> 14);
+        px[2] = cx + ((ri * c) >> 14);
+        py[2] = cy + ((ri * s) >> 14);
+
+        if (hw) {
+            UC1638_Vec_FillConvex(px, py, 4, color);
+        } else {
+            UC1638_Vec_PenTo(px[1], py[1]);
+        }
+    }
+}
+
+// 三次贝塞尔细分 (1/256 像素定点)：控制点偏离弦的程度足够小时以直线代替
+static void UC1638_Vec_Cubic(int32_t x0, int32_t y0, int32_t x1, int32_t y1,
+                             int32_t x2, int32_t y2, int32_t x3, int32_t y3, int depth) {
+    int32_t ux = UC1638_Vec_Abs(3 * x1 - 2 * x0 - x3);
+    int32_t uy = UC1638_Vec_Abs(3 * y1 - 2 * y0 - y3);
+    int32_t vx = UC1638_Vec_Abs(3 * x2 - x0 - 2 * x3);
+    int32_t vy = UC1638_Vec_Abs(3 * y2 - y0 - 2 * y3);
+
+    // 最大偏差 <= (max(ux, vx) + max(uy, vy)) / 4，要求不超过 1/4 像素
+    if (depth >= VEC_MAX_DEPTH || (ux > vx ? ux : vx) + (uy > vy ? uy : vy) <= 256) {
+        UC1638_Vec_PenTo(x3 >> 4, y3 >> 4);
+        return;
+    }
+
+    // de Casteljau 在 t = 1/2 处一分为二
+    int32_t x01 = (x0 + x1) >> 1, y01 = (y0 + y1) >> 1;
+    int32_t x12 = (x1 + x2) >> 1, y12 = (y1 + y2) >> 1;
+    int32_t x23 = (x2 + x3) >> 1, y23 = (y2 + y3) >> 1;
+    int32_t x012 = (x01 + x12) >> 1, y012 = (y01 + y12) >> 1;
+    int32_t x123 = (x12 + x23) >> 1, y123 = (y12 + y23) >> 1;
+    int32_t xm = (x012 + x123) >> 1, ym = (y012 + y123) >> 1;
+
+    UC1638_Vec_Cubic(x0, y0, x01, y01, x012, y012, xm, ym, depth + 1);
+    UC1638_Vec_Cubic(xm, ym, x123, y123, x23, y23, x3, y3, depth + 1);
+}
+
+#define VEC_P8(v)   ((int32_t)(v) * 256 + 128) // 像素中心，1/256 像素定点
+
+void UC1638_DrawBezier3(int x0, int y0, int x1, int y1, int x2, int y2, int x3, int y3, int width, LCD_Color_t color) {
+    UC1638_Vec_PenStart(VEC_PIX(x0), VEC_PIX(y0), width, color);
+    UC1638_Vec_Cubic(VEC_P8(x0), VEC_P8(y0), VEC_P8(x1), VEC_P8(y1),
+                     VEC_P8(x2), VEC_P8(y2), VEC_P8(x3), VEC_P8(y3), 0);
+}
+
+void UC1638_DrawBezier2(int x0, int y0, int x1, int y1, int x2, int y2, int width, LCD_Color_t color) {
+    // 升阶为三次：c1 = p0 + 2/3 (p1 - p0)，c2 = p2 + 2/3 (p1 - p2)
+    int32_t cx1 = (VEC_P8(x0) + 2 * VEC_P8(x1)) / 3, cy1 = (VEC_P8(y0) + 2 * VEC_P8(y1)) / 3;
+    int32_t cx2 = (VEC_P8(x2) + 2 * VEC_P8(x1)) / 3, cy2 = (VEC_P8(y2) + 2 * VEC_P8(y1)) / 3;
+
+    UC1638_Vec_PenStart(VEC_PIX(x0), VEC_PIX(y0), width, color);
+    UC1638_Vec_Cubic(VEC_P8(x0), VEC_P8(y0), cx1, cy1, cx2, cy2, VEC_P8(x2), VEC_P8(y2), 0);
+}
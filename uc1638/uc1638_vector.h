@@ -0,0 +1,32 @@
+/*
+ * uc1638_vector.h
+ * 定点矢量图形：粗线、圆弧、二次/三次贝塞尔曲线 (仪表盘指针、趋势曲线)
+ *
+ * 全部使用整数运算 (1/16 像素定点坐标 + Q14 正弦表)，不依赖浮点与 libm。
+ * 图形先离散为凸多边形，再逐列求覆盖范围，以竖直段交给 UC1638_Fill 的字节掩码写入；
+ * 按像素中心取点，同样的参数总是得到同样的像素，指针缓慢转动时不会抖动。
+ * 坐标遵循当前原点与裁剪区，有效范围约 ±1000 像素。
+ *
+ * 角度以度为单位，0 度指向右 (3 点钟方向)，按屏幕顺时针增加 (y 轴向下)。
+ */
+
+#ifndef __UC1638_VECTOR_H
+#define __UC1638_VECTOR_H
+
+#include <stdint.h>
+#include "uc1638.h"
+
+// 线宽 width <= 1 时退化为 1 像素细线
+void UC1638_DrawThickLine(int x1, int y1, int x2, int y2, int width, LCD_Color_t color); // 圆头
+
+// 从 start 顺时针画到 end (度)，end <= start 时跨过 0 度；两者相差 360 为整圆
+void UC1638_DrawArc(int x0, int y0, int r, int start, int end, int width, LCD_Color_t color);
+
+// 贝塞尔曲线：按平直度自适应细分 (偏差不超过 1/4 像素)
+void UC1638_DrawBezier2(int x0, int y0, int x1, int y1, int x2, int y2, int width, LCD_Color_t color);
+void UC1638_DrawBezier3(int x0, int y0, int x1, int y1, int x2, int y2, int x3, int y3, int width, LCD_Color_t color);
+
+// 极坐标取点 (四舍五入到像素)，用于计算指针端点、刻度位置
+void UC1638_Polar(int x0, int y0, int r, int angle, int *x, int *y);
+
+#endif /* __UC1638_VECTOR_H */